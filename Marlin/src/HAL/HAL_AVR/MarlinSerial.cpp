@@ -42,6 +42,7 @@
 
   #include "MarlinSerial.h"
   #include "../../Marlin.h"
+  #include "../../libs/numtostr.h"
 
   template<typename Cfg> typename MarlinSerial<Cfg>::ring_buffer_r MarlinSerial<Cfg>::rx_buffer = { 0, 0, { 0 } };
   template<typename Cfg> typename MarlinSerial<Cfg>::ring_buffer_t MarlinSerial<Cfg>::tx_buffer = { 0 };
@@ -504,6 +505,32 @@
     }
   }
 
+  template<typename Cfg>
+  void MarlinSerial<Cfg>::write(const uint8_t* buffer, size_t size) {
+    // Without a TX buffer, or from an ISR, go byte by byte
+    if (Cfg::TX_SIZE == 0 || !ISRS_ENABLED()) {
+      while (size--) write(*buffer++);
+      return;
+    }
+
+    _written = true;
+
+    while (size) {
+      // Copy as much as fits, then publish the new head once
+      uint8_t h = tx_buffer.head;
+      const uint8_t t = tx_buffer.tail;
+      for (uint8_t i; size && (i = (h + 1) & (Cfg::TX_SIZE - 1)) != t; h = i, size--)
+        tx_buffer.buffer[h] = *buffer++;
+      tx_buffer.head = h;
+
+      // Enable TX ISR - Non atomic, but it will eventually enable TX ISR
+      B_UDRIE = 1;
+
+      // Wait until there is space for more
+      if (size) while (((tx_buffer.head + 1) & (Cfg::TX_SIZE - 1)) == tx_buffer.tail) sw_barrier();
+    }
+  }
+
   template<typename Cfg>
   void MarlinSerial<Cfg>::flushTX() {
 
@@ -674,33 +701,8 @@
 
   template<typename Cfg>
   void MarlinSerial<Cfg>::printFloat(double number, uint8_t digits) {
-    // Handle negative numbers
-    if (number < 0.0) {
-      print('-');
-      number = -number;
-    }
-
-    // Round correctly so that print(1.999, 2) prints as "2.00"
-    double rounding = 0.5;
-    for (uint8_t i = 0; i < digits; ++i) rounding *= 0.1;
-    number += rounding;
-
-    // Extract the integer part of the number and print it
-    unsigned long int_part = (unsigned long)number;
-    double remainder = number - (double)int_part;
-    print(int_part);
-
-    // Print the decimal point, but only if there are digits beyond
-    if (digits) {
-      print('.');
-      // Extract digits from the remainder one at a time
-      while (digits--) {
-        remainder *= 10.0;
-        int toPrint = int(remainder);
-        print(toPrint);
-        remainder -= toPrint;
-      }
-    }
+    char buf[FTOSTRFIX_SIZE(FTOSTRFIX_MAX_DIGITS)];
+    write((const uint8_t*)buf, ftostrfix(buf, number, digits) - buf);
   }
 
   // Hookup ISR handlers
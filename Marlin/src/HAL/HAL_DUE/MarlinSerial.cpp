@@ -32,6 +32,7 @@
 #include "MarlinSerial.h"
 #include "InterruptVectors.h"
 #include "../../Marlin.h"
+#include "../../libs/numtostr.h"
 
 template<typename Cfg> typename MarlinSerial<Cfg>::ring_buffer_r MarlinSerial<Cfg>::rx_buffer = { 0, 0, { 0 } };
 template<typename Cfg> typename MarlinSerial<Cfg>::ring_buffer_t MarlinSerial<Cfg>::tx_buffer = { 0 };
@@ -598,33 +599,8 @@ void MarlinSerial<Cfg>::printNumber(unsigned long n, uint8_t base) {
 
 template<typename Cfg>
 void MarlinSerial<Cfg>::printFloat(double number, uint8_t digits) {
-  // Handle negative numbers
-  if (number < 0.0) {
-    print('-');
-    number = -number;
-  }
-
-  // Round correctly so that print(1.999, 2) prints as "2.00"
-  double rounding = 0.5;
-  for (uint8_t i = 0; i < digits; ++i) rounding *= 0.1;
-  number += rounding;
-
-  // Extract the integer part of the number and print it
-  unsigned long int_part = (unsigned long)number;
-  double remainder = number - (double)int_part;
-  print(int_part);
-
-  // Print the decimal point, but only if there are digits beyond
-  if (digits) {
-    print('.');
-    // Extract digits from the remainder one at a time
-    while (digits--) {
-      remainder *= 10.0;
-      int toPrint = int(remainder);
-      print(toPrint);
-      remainder -= toPrint;
-    }
-  }
+  char buf[FTOSTRFIX_SIZE(FTOSTRFIX_MAX_DIGITS)];
+  write((const uint8_t*)buf, ftostrfix(buf, number, digits) - buf);
 }
 
 // If not using the USB port as serial port
@@ -32,6 +32,7 @@
 #if SERIAL_PORT == -1
 
 #include "MarlinSerialUSB.h"
+#include "../../libs/numtostr.h"
 
 #if ENABLED(EMERGENCY_PARSER)
   #include "../../feature/emergency_parser.h"
@@ -254,35 +255,8 @@ void MarlinSerialUSB::printNumber(unsigned long n, uint8_t base) {
 }
 
 void MarlinSerialUSB::printFloat(double number, uint8_t digits) {
-  // Handle negative numbers
-  if (number < 0.0) {
-    print('-');
-    number = -number;
-  }
-
-  // Round correctly so that print(1.999, 2) prints as "2.00"
-  double rounding = 0.5;
-  for (uint8_t i = 0; i < digits; ++i)
-    rounding *= 0.1;
-
-  number += rounding;
-
-  // Extract the integer part of the number and print it
-  unsigned long int_part = (unsigned long)number;
-  double remainder = number - (double)int_part;
-  print(int_part);
-
-  // Print the decimal point, but only if there are digits beyond
-  if (digits) {
-    print('.');
-    // Extract digits from the remainder one at a time
-    while (digits--) {
-      remainder *= 10.0;
-      int toPrint = int(remainder);
-      print(toPrint);
-      remainder -= toPrint;
-    }
-  }
+  char buf[FTOSTRFIX_SIZE(FTOSTRFIX_MAX_DIGITS)];
+  write((const uint8_t*)buf, ftostrfix(buf, number, digits) - buf);
 }
 
 // Preinstantiate
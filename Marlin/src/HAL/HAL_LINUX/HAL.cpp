@@ -24,8 +24,32 @@
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
+#include "../../gcode/queue.h"
+#include "../../module/planner.h"
+
+#define IDLE_SLEEP_US 1000 // Longest sleep in HAL_idletask()
 
 HalSerial usb_serial;
+#if NUM_SERIAL > 1
+  HalSerial usb_serial2;
+#endif
+
+/**
+ * Sleep while the firmware is only waiting, so an idle instance uses no CPU.
+ * If the command queue or the planner changed since the last call there may
+ * be more to do, so return at once. Otherwise sleep until serial data comes
+ * in or IDLE_SLEEP_US passes.
+ */
+void HAL_idletask() {
+  static uint32_t last_state;
+  const uint32_t state = queue.length | uint32_t(queue.index_r) << 8
+                       | uint32_t(planner.block_buffer_head) << 16 | uint32_t(planner.block_buffer_tail) << 24;
+  if (state != last_state) {
+    last_state = state;
+    return;
+  }
+  usb_serial.wait_for_data(IDLE_SLEEP_US);
+}
 
 // U8glib required functions
 extern "C" void u8g_xMicroDelay(uint16_t val) {
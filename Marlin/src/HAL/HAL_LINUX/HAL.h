@@ -61,9 +61,16 @@ uint8_t _getc();
 
 #define SHARED_SERVOS HAS_SERVOS
 
+// Port 0 is stdin/stdout or a pseudo-terminal. Port 1 is always a pseudo-terminal. See main.cpp.
 extern HalSerial usb_serial;
 #define MYSERIAL0 usb_serial
-#define NUM_SERIAL 1
+#ifdef SERIAL_PORT_2
+  extern HalSerial usb_serial2;
+  #define MYSERIAL1 usb_serial2
+  #define NUM_SERIAL 2
+#else
+  #define NUM_SERIAL 1
+#endif
 
 #define ST7920_DELAY_1 DELAY_NS(600)
 #define ST7920_DELAY_2 DELAY_NS(750)
@@ -80,6 +87,16 @@ extern HalSerial usb_serial;
 
 inline void HAL_init() { }
 
+// Build with -DMOTION_LOGGING to log step pulses and planner blocks. See main.cpp
+#ifdef MOTION_LOGGING
+  struct block_t;
+  void motion_log_block(const block_t * const block);
+  #define HAL_STEPPER_BLOCK_HOOK(B) motion_log_block(B)
+#endif
+
+#define HAL_IDLETASK 1
+void HAL_idletask();
+
 // Utility functions
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
@@ -22,40 +22,108 @@
 
 #ifdef __PLAT_LINUX__
 
+#include <random>
 #include "Clock.h"
 #include <stdio.h>
 #include "../../../inc/MarlinConfig.h"
+#include "../../../module/planner.h"
+#include "../../../module/thermistor/thermistors.h"
 
 #include "Heater.h"
+#include "LinearAxis.h"
 
-Heater::Heater(pin_t heater, pin_t adc) {
-  heater_state = 0;
-  room_temp_raw = 150;
-  last = Clock::micros();
+#define FAN_SPINUP_TIME 0.5 // Fan speed time constant (s)
+
+double Heater::ambient = 25.0;
+
+// Fixed seed, so runs are repeatable
+static std::mt19937 rng(1);
+static std::normal_distribution<double> noise(0.0, 1.0);
+
+Heater::Heater(pin_t heater, pin_t adc, const ThermalModel &model, const short (*table)[2], uint8_t table_len,
+               pin_t fan/*=P_NC*/, LinearAxis *extruder/*=nullptr*/
+) : model(model), table(table), table_len(table_len), extruder(extruder) {
   heater_pin = heater;
   adc_pin = adc;
-  heat = 0.0;
+  fan_pin = fan;
+  temperature = sensor_temperature = ambient;
+  fan_speed = flow_rate = 0.0;
+  extruded_max = extruder ? extruder->position : 0;
+
+  last = report_time = edge_time = Clock::nanos();
+  on_time = last_on_time = report_on_time = 0;
+  level = 0;
+
+  Gpio::attachPeripheral(heater_pin, this);
 }
 
 Heater::~Heater() {
 }
 
+static uint16_t pwm_level(const uint16_t value) { return value > 1 ? _MIN(value, 255) : value * 255; }
+
+// Digital writes and analogWrite both end here, so on-time is exact at any PWM rate
+void Heater::interrupt(GpioEvent ev) {
+  if (ev.pin_id != heater_pin) return;
+  on_time += (ev.timestamp - edge_time) * level / 255;
+  edge_time = ev.timestamp;
+  level = pwm_level(Gpio::pin_map[heater_pin].value);
+}
+
 void Heater::update() {
-  // crude pwm read and cruder heat simulation
-  auto now = Clock::micros();
-  double delta = (now - last);
-  if (delta > 1000 ) {
-    heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
-    last = now;
-    heat += (heater_state - heat) * (delta / 1000000000.0);
-
-    NOLESS(heat, room_temp_raw);
-    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = 0xFFFF - (uint16_t)heat;
+  const uint64_t now = Clock::nanos();
+  if (now - last < 1000000) return;
+  const double dt = (now - last) / 1000000000.0;
+
+  // Mean heater duty since the last update
+  const uint64_t on = on_time + (now - edge_time) * level / 255;
+  const double duty = constrain(double(on - last_on_time) / (now - last), 0.0, 1.0);
+  last_on_time = on;
+  last = now;
+
+  if (fan_pin != P_NC)
+    fan_speed += (pwm_level(Gpio::get(fan_pin)) / 255.0 - fan_speed) * _MIN(dt / (FAN_SPINUP_TIME), 1.0);
+
+  // Only filament that hasn't been through the hotend before takes heat away
+  double fed_mm = 0.0;
+  if (extruder && extruder->position > extruded_max) {
+    fed_mm = (extruder->position - extruded_max) / planner.settings.axis_steps_per_mm[E_AXIS];
+    extruded_max = extruder->position;
+  }
+  flow_rate += (fed_mm / dt - flow_rate) * _MIN(dt, 1.0); // About 1s average, for reports
+
+  const double rise = temperature - ambient,
+               loss = (model.loss + fan_speed * model.fan_loss) * rise * dt + model.flow_capacity * fed_mm * rise;
+  temperature += (duty * model.power * dt - loss) / model.capacity;
+  sensor_temperature += (temperature - sensor_temperature) * _MIN(dt / model.sensor_lag, 1.0);
+
+  // Each update is a new conversion, so oversampling sees fresh noise
+  if (table) {
+    const int32_t adc = LROUND(celsius_to_adc(sensor_temperature) + noise(rng) * model.adc_noise);
+    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = constrain(adc, 0, 1023) << 2;
   }
 }
 
-void Heater::interrupt(GpioEvent ev) {
-  // ununsed
+// Interpolate the thermistor table backwards, to a 10-bit ADC value
+double Heater::celsius_to_adc(const double celsius) {
+  for (uint8_t i = 1; i < table_len; i++) {
+    const double t0 = table[i - 1][1], t1 = table[i][1];
+    if (WITHIN(celsius, _MIN(t0, t1), _MAX(t0, t1)) && t0 != t1)
+      return (table[i - 1][0] + (celsius - t0) * (table[i][0] - table[i - 1][0]) / (t1 - t0)) / (OVERSAMPLENR);
+  }
+  // Off the table, so use the nearer end
+  const bool first = ABS(celsius - table[0][1]) < ABS(celsius - table[table_len - 1][1]);
+  return table[first ? 0 : table_len - 1][0] / double(OVERSAMPLENR);
+}
+
+void Heater::report(FILE *out, const char *name) {
+  const uint64_t now = Clock::nanos(), on = on_time + (now - edge_time) * level / 255;
+  fprintf(out, "%s: %.2fC, sensor %.2fC, duty %.1f%%, fan %.0f%%, flow %.2fmm/s\n",
+    name, temperature, sensor_temperature, 100.0 * (on - report_on_time) / _MAX(now - report_time, uint64_t(1)),
+    100.0 * fan_speed, flow_rate
+  );
+  report_on_time = on;
+  report_time = now;
 }
 
 #endif // __PLAT_LINUX__
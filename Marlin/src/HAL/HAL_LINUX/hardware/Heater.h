@@ -21,27 +21,58 @@
  */
 #pragma once
 
+#include <atomic>
+#include <stdio.h>
 #include "Gpio.h"
 
-struct LowpassFilter {
-  uint64_t data_delay = 0;
-  uint16_t update(uint16_t value) {
-    data_delay = data_delay - (data_delay >> 6) + value;
-    return (uint16_t)(data_delay >> 6);
-  }
+class LinearAxis;
+
+/**
+ * Lumped thermal model of a heater block. The block has one temperature,
+ * raised by heater power and pulled toward ambient by losses that grow with
+ * part fan speed and with cold filament fed through it. The sensor follows
+ * the block with a first-order lag.
+ */
+struct ThermalModel {
+  double power,         // Heater power at full duty (W)
+         capacity,      // Heat capacity (J/K)
+         loss,          // Loss to ambient (W/K)
+         fan_loss,      // Extra loss with the part fan at full speed (W/K)
+         flow_capacity, // Heat taken by each mm of filament fed (J/K/mm)
+         sensor_lag,    // Sensor time constant (s)
+         adc_noise;     // Noise at the ADC input (LSB RMS)
 };
 
+#define THERMAL_MODEL_HOTEND {  40.0,  12.0, 0.12, 0.05, 0.0054, 1.5, 0.5 } // 40W cartridge, 1.75mm PLA
+#define THERMAL_MODEL_BED    { 250.0, 600.0, 1.50, 0.10, 0.0,    6.0, 0.5 } // 250W aluminium bed
+
 class Heater: public Peripheral {
 public:
-  Heater(pin_t heater, pin_t adc);
+  Heater(pin_t heater, pin_t adc, const ThermalModel &model, const short (*table)[2], uint8_t table_len,
+         pin_t fan=P_NC, LinearAxis *extruder=nullptr);
   virtual ~Heater();
   void interrupt(GpioEvent ev);
   void update();
 
-  pin_t heater_pin, adc_pin;
-  uint16_t room_temp_raw;
-  uint16_t heater_state;
-  LowpassFilter pwmcap;
-  double heat;
-  uint64_t last;
+  // Print the current state, with the mean duty since the last report
+  void report(FILE *out, const char *name);
+
+  static double ambient; // (°C)
+
+  pin_t heater_pin, adc_pin, fan_pin;
+  ThermalModel model;
+  double temperature, sensor_temperature, fan_speed, flow_rate;
+
+private:
+  double celsius_to_adc(const double celsius);
+
+  const short (*table)[2];
+  uint8_t table_len;
+  LinearAxis *extruder;
+  int32_t extruded_max;
+
+  // Heater on-time, integrated from pin edges
+  std::atomic<uint64_t> on_time, edge_time;
+  std::atomic<uint16_t> level; // 0-255
+  uint64_t last, last_on_time, report_time, report_on_time;
 };
@@ -23,11 +23,23 @@
 #ifdef __PLAT_LINUX__
 
 #include <random>
+#include <math.h>
 #include <stdio.h>
 #include "Clock.h"
 #include "LinearAxis.h"
+#include "../../../inc/MarlinConfig.h"
+#include "../../../module/planner.h"
 
-LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max) {
+#define MOTOR_FULL_STEPS      200     // Per revolution. The rotor has a quarter as many teeth.
+#define SIM_STEP_NS           10000   // Integration step
+#define COMMAND_SPEED_TC      0.0005  // Smoothing of the step rate, for motor damping (s)
+#define REST_SPEED            1e-5    // Below this an idle axis stops being simulated (m/s)
+
+IOLogger* LinearAxis::step_logger = nullptr;
+
+LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max,
+                       uint8_t axis, const AxisModel &model
+) : axis(axis), model(model) {
   enable_pin = enable;
   dir_pin = dir;
   step_pin = step;
@@ -39,6 +51,14 @@ LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type en
   position = rand() % ((max_position - 40) - min_position) + (min_position + 20);
   last_update = Clock::nanos();
 
+  step_queue_head = step_queue_tail = 0;
+  commanded = position;
+  steps_per_mm = 0;
+  sim_time = last_update;
+  missed_steps = 0;
+  following_error = peak_following_error = max_following_error = 0;
+  reset();
+
   Gpio::attachPeripheral(step_pin, this);
 
 }
@@ -47,8 +67,99 @@ LinearAxis::~LinearAxis() {
 
 }
 
+// Put the drive at rest at the commanded position
+void LinearAxis::reset() {
+  const double rad_per_step = steps_per_mm ? 2 * M_PI / (steps_per_mm * model.travel_per_rev) : 0;
+  last_target = rotor_angle = commanded * rad_per_step;
+  load_position = steps_per_mm ? commanded / steps_per_mm / 1000.0 : 0;
+  rotor_speed = load_speed = command_speed = 0;
+  slip = 0;
+  at_rest = true;
+}
+
+// Integrate up to the given time with the current commanded position. Return the peak speed.
+double LinearAxis::simulate(const uint64_t until) {
+  if (at_rest || !steps_per_mm) {
+    sim_time = _MAX(sim_time, until);
+    return 0;
+  }
+
+  const double lead = model.travel_per_rev / 1000.0 / (2 * M_PI),        // m/rad
+               target = commanded * 2 * M_PI / (steps_per_mm * model.travel_per_rev),
+               target_mm = commanded / steps_per_mm,
+               pole_pairs = (MOTOR_FULL_STEPS) / 4,
+               corner = model.corner_speed * 2 * M_PI,
+               motor_damping = 2 * model.damping * sqrt(model.holding_torque * pole_pairs * model.rotor_inertia),
+               drive_damping = 2 * model.damping * sqrt(model.stiffness * model.mass);
+
+  // A new step adds an impulse that the smoothing spreads over the next moments
+  command_speed += (target - last_target) / (COMMAND_SPEED_TC);
+  last_target = target;
+
+  double peak_speed = 0;
+  while (sim_time < until) {
+    const double dt = _MIN(until - sim_time, uint64_t(SIM_STEP_NS)) / 1000000000.0;
+    sim_time += _MIN(until - sim_time, uint64_t(SIM_STEP_NS));
+    command_speed -= command_speed * _MIN(dt / (COMMAND_SPEED_TC), 1.0);
+
+    // Motor torque pulls the rotor toward the nearest stable position, and falls off at speed
+    const double error = pole_pairs * (rotor_angle - target),
+                 speed = ABS(rotor_speed),
+                 torque_max = model.holding_torque * (speed > corner ? corner / speed : 1.0),
+                 force = model.stiffness * (rotor_angle * lead - load_position)
+                       + drive_damping * (rotor_speed * lead - load_speed),
+                 torque = -torque_max * sin(error) - motor_damping * (rotor_speed - command_speed) - force * lead;
+    rotor_speed += torque / model.rotor_inertia * dt;
+    rotor_angle += rotor_speed * dt;
+
+    // The load sticks until the drive overcomes friction, and friction never reverses it
+    if (load_speed != 0 || ABS(force) > model.friction) {
+      const double before = load_speed,
+                   drag = model.friction * (before ? SIGN(before) : SIGN(force));
+      load_speed += (force - drag) / model.mass * dt;
+      if (before * load_speed < 0) load_speed = 0;
+    }
+    load_position += load_speed * dt;
+
+    // Past two full steps of lag the rotor falls into the next stable position
+    const int32_t s = lround(error / (2 * M_PI));
+    if (s != slip) {
+      missed_steps += 4 * ABS(s - slip);
+      slip = s;
+    }
+
+    following_error = load_position * 1000.0 - target_mm;
+    NOLESS(peak_following_error, ABS(following_error));
+    peak_speed = _MAX(peak_speed, ABS(load_speed), ABS(rotor_speed * lead));
+  }
+  NOLESS(max_following_error, peak_following_error);
+  return peak_speed;
+}
+
+// Replay the queued steps at the times they were made, then catch up to now
 void LinearAxis::update() {
+  const double spm = planner.settings.axis_steps_per_mm[axis];
+  if (spm != steps_per_mm) {
+    // New scale, as when settings load. Start from rest at the current position.
+    for (; step_queue_tail != step_queue_head; step_queue_tail++)
+      commanded = step_queue[step_queue_tail % step_queue_size].position;
+    steps_per_mm = spm;
+    reset();
+  }
 
+  bool stepped = false;
+  for (; step_queue_tail != step_queue_head; step_queue_tail++) {
+    const StepEvent &ev = step_queue[step_queue_tail % step_queue_size];
+    simulate(ev.timestamp);
+    commanded = ev.position;
+    at_rest = false;
+    stepped = true;
+  }
+
+  if (simulate(Clock::nanos()) < (REST_SPEED) && !stepped && !at_rest) {
+    at_rest = true;
+    rotor_speed = load_speed = command_speed = 0;
+  }
 }
 
 void LinearAxis::interrupt(GpioEvent ev) {
@@ -56,11 +167,25 @@ void LinearAxis::interrupt(GpioEvent ev) {
     if (ev.event == GpioEvent::RISE) {
       last_update = ev.timestamp;
       position += -1 + 2 * Gpio::pin_map[dir_pin].value;
+      if (step_logger != nullptr) step_logger->log(ev);
       Gpio::pin_map[min_pin].value = (position < min_position);
       //Gpio::pin_map[max_pin].value = (position > max_position);
       //if (position < min_position) printf("axis(%d) endstop : pos: %d, mm: %f, min: %d\n", step_pin, position, position / 80.0, Gpio::pin_map[min_pin].value);
+
+      // When the queue is full the step is only skipped. The next one carries the position.
+      const uint32_t head = step_queue_head;
+      if (head - step_queue_tail < step_queue_size) {
+        step_queue[head % step_queue_size] = { ev.timestamp, position };
+        step_queue_head = head + 1;
+      }
     }
   }
 }
 
+void LinearAxis::report(FILE *out, const char *name) {
+  fprintf(out, "%s: missed %u full steps, following error %.4fmm, peak %.4fmm (max %.4fmm)\n",
+    name, missed_steps, following_error, peak_following_error, max_following_error);
+  peak_following_error = 0;
+}
+
 #endif // __PLAT_LINUX__
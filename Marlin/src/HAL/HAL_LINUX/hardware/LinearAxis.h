@@ -21,16 +21,45 @@
  */
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <stdio.h>
 #include "Gpio.h"
 
+/**
+ * Drive train of one axis: a stepper rotor coupled to the moving mass
+ * through a belt or screw. The rotor is pulled toward the commanded step
+ * position by a torque that falls off with speed. If the rotor lags by more
+ * than two full steps it drops to the next stable position and the steps are
+ * lost. The coupling is a spring with damping, so motion rings at the drive's
+ * resonance.
+ */
+struct AxisModel {
+  double mass,           // Moving mass (kg)
+         travel_per_rev, // Travel per motor revolution (mm)
+         holding_torque, // Motor torque at low speed (Nm)
+         corner_speed,   // Speed above which torque falls as 1/speed (rev/s)
+         rotor_inertia,  // (kg m^2)
+         stiffness,      // Belt or screw stiffness (N/m)
+         damping,        // Damping ratio of the motor and the belt or screw
+         friction;       // Coulomb friction on the moving mass (N)
+};
+
+#define AXIS_MODEL_BELT     { 0.50, 40.0, 0.45, 5.0, 5.4e-6, 4.0e4, 0.05, 2.0 } // GT2 belt, 20T pulley, NEMA17
+#define AXIS_MODEL_SCREW    { 1.50,  8.0, 0.45, 5.0, 5.4e-6, 5.0e6, 0.05, 5.0 } // T8 lead screw
+#define AXIS_MODEL_EXTRUDER { 0.02, 22.0, 0.30, 5.0, 3.5e-6, 2.0e4, 0.10, 1.0 } // Direct drive gear
+
 class LinearAxis: public Peripheral {
 public:
-  LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max);
+  LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max,
+             uint8_t axis, const AxisModel &model);
   virtual ~LinearAxis();
   void update();
   void interrupt(GpioEvent ev);
 
+  // Print missed steps and the peak following error since the last report and overall
+  void report(FILE *out, const char *name);
+
   pin_type enable_pin;
   pin_type dir_pin;
   pin_type step_pin;
@@ -42,4 +71,29 @@ public:
   int32_t max_position;
   uint64_t last_update;
 
+  static IOLogger* step_logger; // Receives every step pulse of every axis, if set
+
+  uint8_t axis;         // Index into the planner's steps/mm
+  AxisModel model;
+  uint32_t missed_steps; // Full steps lost to stalls
+  double following_error, peak_following_error, max_following_error; // Load vs. command (mm)
+
+private:
+  void reset();
+  double simulate(const uint64_t until);
+
+  // Step times, queued by the step interrupt for update() to replay
+  struct StepEvent { uint64_t timestamp; int32_t position; };
+  static const uint32_t step_queue_size = 4096;
+  StepEvent step_queue[step_queue_size];
+  std::atomic<uint32_t> step_queue_head, step_queue_tail;
+
+  double steps_per_mm;                // Scale the model was set up with, 0 before the planner has one
+  int32_t commanded;                  // Steps, as replayed so far
+  double last_target, command_speed;  // Commanded rotor angle and its smoothed rate (rad, rad/s)
+  uint64_t sim_time;                  // (ns)
+  bool at_rest;
+  double rotor_angle, rotor_speed,    // (rad, rad/s)
+         load_position, load_speed;   // (m, m/s)
+  int32_t slip;                       // Stable positions the rotor has dropped, 4 full steps each
 };
@@ -0,0 +1,169 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include <thread>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "Clock.h"
+#include "../../../inc/MarlinConfig.h"
+
+#include "SerialPort.h"
+
+#define SERIAL_BITS_PER_BYTE 10   // Start, 8 data and stop bit
+#define SERIAL_CHUNK_US      1000 // Bytes are moved in batches of about this much wire time
+
+bool SerialPort::pace = false;
+
+SerialPort::SerialPort(HalSerial &serial) : serial(serial) {
+  fd_in = fd_out = pty_slave = -1;
+  rx_bytes = tx_bytes = rx_peak = tx_peak = 0;
+  last_report = Clock::micros();
+}
+
+bool SerialPort::open_stdio() {
+  fd_in = STDIN_FILENO;
+  fd_out = STDOUT_FILENO;
+  return true;
+}
+
+/**
+ * Create a pseudo-terminal and link it as link_name in the working directory.
+ * The slave end is kept open so hosts can connect and disconnect at will.
+ * Output sent while no host is reading is lost, as with a real UART.
+ */
+bool SerialPort::open_pty(const char *link_name) {
+  const int master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (master < 0 || grantpt(master) || unlockpt(master)) {
+    perror("posix_openpt");
+    return false;
+  }
+
+  const char * const slave_name = ptsname(master);
+  pty_slave = open(slave_name, O_RDWR | O_NOCTTY);
+  if (pty_slave < 0) {
+    perror(slave_name);
+    return false;
+  }
+
+  termios tio;
+  tcgetattr(pty_slave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(pty_slave, TCSANOW, &tio);
+
+  unlink(link_name);
+  if (symlink(slave_name, link_name)) perror(link_name);
+  fprintf(stderr, "%s -> %s\n", link_name, slave_name);
+
+  fd_in = fd_out = master;
+  return true;
+}
+
+void SerialPort::start() {
+  std::thread(&SerialPort::read_thread, this).detach();
+  std::thread(&SerialPort::write_thread, this).detach();
+}
+
+void SerialPort::report(FILE *out, const char *name) {
+  const uint64_t now = Clock::micros();
+  const float secs = _MAX(now - last_report, uint64_t(1)) / 1000000.0f;
+  last_report = now;
+  fprintf(out, "%s: %d baud%s, rx %.0f B/s, tx %.0f B/s, peak queued rx %u/%u tx %u/%u, dropped %u\n",
+    name, int(serial.baud_rate), pace ? "" : " (unpaced)",
+    rx_bytes.exchange(0) / secs, tx_bytes.exchange(0) / secs,
+    unsigned(rx_peak.exchange(0)), unsigned(serial.receive_buffer.size()),
+    unsigned(tx_peak.exchange(0)), unsigned(serial.transmit_buffer.size()),
+    unsigned(serial.dropped())
+  );
+}
+
+// The number of bytes that take SERIAL_CHUNK_US on the wire
+size_t SerialPort::chunk_size() {
+  return _MAX(size_t(1), size_t(serial.baud_rate * (SERIAL_CHUNK_US) / (1000000UL * (SERIAL_BITS_PER_BYTE))));
+}
+
+// Sleep until the given bytes have crossed the wire after those before them
+void SerialPort::wait_for_wire(uint64_t &wire_free, const size_t bytes) {
+  const uint64_t now = Clock::micros();
+  wire_free = _MAX(wire_free, now) + bytes * (SERIAL_BITS_PER_BYTE) * 1000000ULL / _MAX(serial.baud_rate, 1);
+  if (wire_free > now) Clock::delayMicros(wire_free - now);
+}
+
+void SerialPort::read_thread() {
+  uint8_t buffer[128];
+  uint64_t wire_free = 0;
+  for (;;) {
+    pollfd pfd = { fd_in, POLLIN, 0 };
+    poll(&pfd, 1, -1);
+    const ssize_t len = read(fd_in, buffer, sizeof(buffer));
+    if (len < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+    if (len <= 0) break; // End of input
+
+    for (ssize_t i = 0; i < len;) {
+      ssize_t n = len - i;
+      if (pace) {
+        n = _MIN(n, ssize_t(chunk_size()));
+        wait_for_wire(wire_free, n);
+      }
+      for (; n--; i++) {
+        if (!pace) serial.rx_signal.wait([this]{ return !serial.receive_buffer.full(); });
+        serial.receive(buffer[i]);
+      }
+      rx_peak = _MAX(rx_peak.load(), serial.receive_buffer.available());
+    }
+    rx_bytes += len;
+  }
+}
+
+void SerialPort::write_thread() {
+  uint8_t buffer[128];
+  uint64_t wire_free = 0;
+  for (;;) {
+    serial.tx_signal.wait([this]{ return !serial.transmit_buffer.empty(); });
+    tx_peak = _MAX(tx_peak.load(), serial.transmit_buffer.available());
+
+    // A paced port frees buffer space only as the bytes leave
+    size_t len = _MIN(size_t(serial.transmit_buffer.available()), sizeof(buffer));
+    if (pace) {
+      len = _MIN(len, chunk_size());
+      wait_for_wire(wire_free, len);
+    }
+    for (size_t i = 0; i < len; i++) buffer[i] = serial.transmit_buffer.read();
+    serial.tx_signal.notify();
+    tx_bytes += len;
+
+    for (size_t done = 0; done < len;) {
+      const ssize_t n = write(fd_out, buffer + done, len - done);
+      if (n > 0) done += n;
+      else if (n < 0 && errno == EINTR) continue;
+      else break; // Nobody is reading
+    }
+  }
+}
+
+#endif // __PLAT_LINUX__
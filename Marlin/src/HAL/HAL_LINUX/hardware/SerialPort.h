@@ -0,0 +1,62 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+class HalSerial;
+
+/**
+ * Connects a HalSerial to the host, through stdin/stdout or through a
+ * pseudo-terminal that host software can open like a USB serial port.
+ *
+ * With pacing enabled bytes move no faster than the baud rate given to
+ * HalSerial::begin (8N1), so a host sees the same link limit as on a board.
+ * A received byte that finds the RX buffer full is dropped, as by a UART.
+ */
+class SerialPort {
+public:
+  SerialPort(HalSerial &serial);
+
+  bool open_stdio();
+  bool open_pty(const char *link_name);
+  void start();
+
+  // Print throughput and peak buffer use since the last report
+  void report(FILE *out, const char *name);
+
+  static bool pace;
+
+private:
+  void read_thread();
+  void write_thread();
+  size_t chunk_size();
+  void wait_for_wire(uint64_t &wire_free, size_t bytes);
+
+  HalSerial &serial;
+  int fd_in, fd_out, pty_slave;
+  std::atomic<uint32_t> rx_bytes, tx_bytes, rx_peak, tx_peak;
+  uint64_t last_report;
+};
@@ -28,6 +28,9 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
 
 /**
  * Generic RingBuffer
@@ -42,6 +45,7 @@ public:
   uint32_t free() volatile      { return buffer_size - available(); }
   bool empty() volatile         { return index_read == index_write; }
   bool full() volatile          { return available() == buffer_size; }
+  uint32_t size() volatile      { return buffer_size; }
   void clear() volatile         { index_read = index_write = 0; }
 
   bool peek(T *value) volatile {
@@ -74,6 +78,33 @@ private:
   volatile uint32_t index_read;
 };
 
+/**
+ * Lets a thread sleep until another thread changes a buffer.
+ * Call notify() after every change. The predicate is checked under the
+ * lock, so a change made between the check and the wait isn't missed.
+ */
+class BufferSignal {
+public:
+  template<typename Pred> void wait(Pred pred) {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, pred);
+  }
+
+  template<typename Pred> bool wait_for(const uint32_t us, Pred pred) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return cv.wait_for(lock, std::chrono::microseconds(us), pred);
+  }
+
+  void notify() {
+    { std::lock_guard<std::mutex> lock(mutex); }
+    cv.notify_all();
+  }
+
+private:
+  std::mutex mutex;
+  std::condition_variable cv;
+};
+
 class HalSerial {
 public:
 
@@ -81,9 +112,9 @@ public:
     EmergencyParser::State emergency_state;
   #endif
 
-  HalSerial() { host_connected = true; }
+  HalSerial() { host_connected = true; baud_rate = 0; rx_dropped = rx_max_enqueued = 0; }
 
-  void begin(int32_t baud) { }
+  void begin(int32_t baud) { baud_rate = baud; }
 
   void end() { }
 
@@ -92,14 +123,38 @@ public:
     return receive_buffer.peek(&value) ? value : -1;
   }
 
-  int read() { return receive_buffer.read(); }
+  int read() {
+    const int c = receive_buffer.read();
+    if (c >= 0) rx_signal.notify();
+    return c;
+  }
 
   size_t write(char c) {
     if (!host_connected) return 0;
-    while (!transmit_buffer.free());
-    return transmit_buffer.write(c);
+    if (transmit_buffer.full()) tx_signal.wait([this]{ return !transmit_buffer.full(); });
+    transmit_buffer.write(c);
+    tx_signal.notify();
+    return 1;
+  }
+
+  // Called by the port thread for each byte from the host. A byte that doesn't fit is lost.
+  bool receive(const uint8_t c) {
+    if (!receive_buffer.write(c)) { rx_dropped++; return false; }
+    rx_max_enqueued = _MAX(rx_max_enqueued, receive_buffer.available());
+    rx_signal.notify();
+    return true;
   }
 
+  uint32_t dropped() { return rx_dropped; }
+  uint32_t rxMaxEnqueued() { return rx_max_enqueued; }
+
+  // Wait up to the given time for received data. Return true if there is some.
+  bool wait_for_data(const uint32_t us) {
+    return rx_signal.wait_for(us, [this]{ return !receive_buffer.empty(); });
+  }
+
+  void write(const uint8_t *buffer, size_t size) { while (size--) write((char)*buffer++); }
+
   operator bool() { return host_connected; }
 
   uint16_t available() {
@@ -114,7 +169,7 @@ public:
 
   void flushTX() {
     if (host_connected)
-      while (transmit_buffer.available()) { /* nada */ }
+      tx_signal.wait([this]{ return transmit_buffer.empty(); });
   }
 
   void printf(const char *format, ...) {
@@ -123,15 +178,8 @@ public:
     va_start(vArgs, format);
     int length = vsnprintf((char *) buffer, 256, (char const *) format, vArgs);
     va_end(vArgs);
-    if (length > 0 && length < 256) {
-      if (host_connected) {
-        for (int i = 0; i < length;) {
-          if (transmit_buffer.write(buffer[i])) {
-            ++i;
-          }
-        }
-      }
-    }
+    if (length > 0 && length < 256)
+      for (int i = 0; i < length; i++) write(buffer[i]);
   }
 
   #define DEC 10
@@ -204,5 +252,8 @@ public:
 
   volatile RingBuffer<uint8_t, 128> receive_buffer;
   volatile RingBuffer<uint8_t, 128> transmit_buffer;
+  BufferSignal rx_signal, tx_signal; // Notified when a buffer is read or written
+  volatile int32_t baud_rate;
+  volatile uint32_t rx_dropped, rx_max_enqueued;
   volatile bool host_connected;
 };
@@ -23,11 +23,17 @@
 extern void setup();
 extern void loop();
 
+#include <atomic>
 #include <thread>
 
 #include <iostream>
 #include <fstream>
 
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
 #include "../../inc/MarlinConfig.h"
 #include <stdio.h>
 #include <stdarg.h>
@@ -35,35 +41,99 @@ extern void loop();
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/SerialPort.h"
+#include "sdio.h"
+#include "../../module/planner.h"
+#include "../../module/temperature.h"
 
-// simple stdout / stdin implementation for fake serial port
-void write_serial_thread() {
-  for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
-    }
-    std::this_thread::yield();
-  }
+#define SIMULATION_PERIOD_US 1000 // Time between peripheral updates
+
+// The timer signals stand in for interrupts of the main thread.
+// Threads inherit the mask, so start the helpers with the signals blocked.
+void block_timer_signals(const bool block) {
+  sigset_t mask;
+  sigemptyset(&mask);
+  sigaddset(&mask, SIGRTMIN);
+  pthread_sigmask(block ? SIG_BLOCK : SIG_UNBLOCK, &mask, nullptr);
 }
 
-void read_serial_thread() {
-  char buffer[255] = {};
-  for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
-    std::this_thread::yield();
-  }
+SerialPort port0(MYSERIAL0);
+#if NUM_SERIAL > 1
+  SerialPort port1(MYSERIAL1);
+#endif
+uint32_t report_interval_ms = 0; // Statistics period, 0 for none
+
+ThermalModel hotend_model = THERMAL_MODEL_HOTEND,
+             bed_model = THERMAL_MODEL_BED;
+
+#ifndef BED_TEMPTABLE
+  #define BED_TEMPTABLE nullptr
+#endif
+
+AxisModel axis_models[XYZE] = { AXIS_MODEL_BELT, AXIS_MODEL_BELT, AXIS_MODEL_SCREW, AXIS_MODEL_EXTRUDER };
+
+bool parse_axis_model(const char *arg) {
+  const char *axis = (const char*)memchr(axis_codes, toupper(arg[0]), XYZE);
+  if (!axis || arg[1] != '=') return false;
+  AxisModel &model = axis_models[axis - axis_codes];
+  return sscanf(arg + 2, "%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf", &model.mass, &model.travel_per_rev, &model.holding_torque,
+                &model.corner_speed, &model.rotor_inertia, &model.stiffness, &model.damping, &model.friction) == 8;
 }
 
+bool parse_thermal_model(const char *arg, ThermalModel &model) {
+  return sscanf(arg, "%lf,%lf,%lf,%lf,%lf,%lf,%lf", &model.power, &model.capacity, &model.loss,
+                &model.fan_loss, &model.flow_capacity, &model.sensor_lag, &model.adc_noise) == 7;
+}
+
+/**
+ * MOTION_LOGGING writes every step pulse to step_log.csv and every block, as
+ * the stepper takes it, to block_log.csv. buildroot/share/tests/host has a
+ * script to compare a run against reference logs.
+ */
+#ifdef MOTION_LOGGING
+
+  #define MOTION_LOG_BLOCKS 64
+
+  // The trapezoid of a block as the stepper took it
+  struct MotionLogBlock {
+    uint32_t steps[XYZE];
+    uint8_t direction_bits;
+    uint32_t step_event_count, accelerate_until, decelerate_after,
+             initial_rate, nominal_rate, final_rate, acceleration_steps_per_s2;
+  };
+
+  // Filled by the stepper ISR, emptied by simulation_loop
+  static MotionLogBlock motion_log_ring[MOTION_LOG_BLOCKS];
+  static std::atomic<uint32_t> motion_log_head, motion_log_tail, motion_log_dropped;
+
+  void motion_log_block(const block_t * const block) {
+    const uint32_t head = motion_log_head.load(std::memory_order_relaxed);
+    if (head - motion_log_tail.load(std::memory_order_acquire) >= MOTION_LOG_BLOCKS) {
+      motion_log_dropped++;
+      return;
+    }
+    MotionLogBlock &b = motion_log_ring[head % MOTION_LOG_BLOCKS];
+    LOOP_XYZE(i) b.steps[i] = block->steps[i];
+    b.direction_bits = block->direction_bits;
+    b.step_event_count = block->step_event_count;
+    b.accelerate_until = block->accelerate_until;
+    b.decelerate_after = block->decelerate_after;
+    b.initial_rate = block->initial_rate;
+    b.nominal_rate = block->nominal_rate;
+    b.final_rate = block->final_rate;
+    b.acceleration_steps_per_s2 = block->acceleration_steps_per_s2;
+    motion_log_head.store(head + 1, std::memory_order_release);
+  }
+
+#endif
+
 void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
-  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
-  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
-  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN, X_AXIS, axis_models[X_AXIS]);
+  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN, Y_AXIS, axis_models[Y_AXIS]);
+  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN, Z_AXIS, axis_models[Z_AXIS]);
+  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC, E_AXIS, axis_models[E_AXIS]);
+  Heater hotend(HEATER_0_PIN, TEMP_0_PIN, hotend_model, HEATER_0_TEMPTABLE, HEATER_0_TEMPTABLE_LEN, FAN_PIN, &extruder0);
+  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN, bed_model, BED_TEMPTABLE, BED_TEMPTABLE_LEN, FAN_PIN);
 
   //#define GPIO_LOGGING // Full GPIO and Positional Logging
 
@@ -77,6 +147,15 @@ void simulation_loop() {
     int32_t x,y,z;
   #endif
 
+  #ifdef MOTION_LOGGING
+    IOLoggerCSV step_logger("step_log.csv");
+    LinearAxis::step_logger = &step_logger;
+
+    std::ofstream block_log;
+    block_log.open("block_log.csv");
+    block_log << "steps_x, steps_y, steps_z, steps_e, direction_bits, step_event_count, accelerate_until, decelerate_after, initial_rate, nominal_rate, final_rate, acceleration_steps_per_s2" << std::endl;
+  #endif
+
   for (;;) {
 
     hotend.update();
@@ -100,13 +179,123 @@ void simulation_loop() {
       logger.flush();
     #endif
 
-    std::this_thread::yield();
+    #ifdef MOTION_LOGGING
+      for (uint32_t tail = motion_log_tail.load(std::memory_order_relaxed); tail != motion_log_head.load(std::memory_order_acquire); tail++) {
+        const MotionLogBlock &b = motion_log_ring[tail % MOTION_LOG_BLOCKS];
+        block_log << b.steps[X_AXIS] << ", " << b.steps[Y_AXIS] << ", " << b.steps[Z_AXIS] << ", " << b.steps[E_AXIS]
+                  << ", " << int(b.direction_bits) << ", " << b.step_event_count << ", " << b.accelerate_until << ", " << b.decelerate_after
+                  << ", " << b.initial_rate << ", " << b.nominal_rate << ", " << b.final_rate
+                  << ", " << b.acceleration_steps_per_s2 << std::endl;
+        motion_log_tail.store(tail + 1, std::memory_order_release);
+      }
+      if (motion_log_dropped) {
+        fprintf(stderr, "motion log: %u blocks dropped\n", unsigned(motion_log_dropped.exchange(0)));
+      }
+      block_log.flush();
+      step_logger.flush();
+    #endif
+
+    if (report_interval_ms) {
+      static uint64_t next_report = Clock::millis() + report_interval_ms;
+      if (Clock::millis() >= next_report) {
+        next_report += report_interval_ms;
+        port0.report(stderr, "serial0");
+        #if NUM_SERIAL > 1
+          port1.report(stderr, "serial1");
+        #endif
+        #if ENABLED(SDIO_SUPPORT)
+          SDIO_Report(stderr);
+        #endif
+        hotend.report(stderr, "hotend");
+        bed.report(stderr, "bed");
+        x_axis.report(stderr, "x");
+        y_axis.report(stderr, "y");
+        z_axis.report(stderr, "z");
+        extruder0.report(stderr, "e");
+      }
+    }
+
+    // Steps arrive through pin interrupts, so the rest only needs a periodic update
+    Clock::delayMicros(SIMULATION_PERIOD_US);
   }
 }
 
-int main() {
-  std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+/**
+ * Each instance keeps its state (EEPROM, logs) in its working directory.
+ *
+ *  -C <dir>  Run in <dir>, creating it if needed
+ *  -p        Put serial port 0 on a pseudo-terminal, ttyMarlin0, instead of stdin/stdout.
+ *            Port 1 (SERIAL_PORT_2) is always ttyMarlin1.
+ *  -b        Pace serial data at the configured baud rate
+ *  -r <sec>  Report serial, SD card, heater and axis statistics to stderr every <sec> seconds
+ *  -s <file> SD card image, a FAT disk image file. Default sdcard.img
+ *  -d <card> SD card speed: spi (default), sdio, none
+ *            or <read latency us>,<write latency us>,<bytes/s>
+ *  -a <C>    Ambient temperature. Default 25
+ *  -H <list> Hotend thermal model, see ThermalModel:
+ *            <W>,<J/K>,<W/K>,<fan W/K>,<flow J/K/mm>,<sensor lag s>,<ADC noise LSB>
+ *  -B <list> Bed thermal model, as above
+ *  -M <axis>=<list> Drive model of axis X, Y, Z or E, see AxisModel:
+ *            <kg>,<mm/rev>,<Nm>,<corner rev/s>,<rotor kg m^2>,<N/m>,<damping ratio>,<friction N>
+ */
+int main(int argc, char *argv[]) {
+  bool pty0 = false;
+  for (int opt; (opt = getopt(argc, argv, "C:pbr:s:d:a:H:B:M:")) != -1;) {
+    switch (opt) {
+      case 'C':
+        mkdir(optarg, 0755);
+        if (chdir(optarg) == 0) break;
+        perror(optarg);
+        return 1;
+      case 'p': pty0 = true; break;
+      case 'b': SerialPort::pace = true; break;
+      case 'r': report_interval_ms = atof(optarg) * 1000; break;
+      case 'a': Heater::ambient = atof(optarg); break;
+      case 'H':
+      case 'B':
+        if (parse_thermal_model(optarg, opt == 'H' ? hotend_model : bed_model)) break;
+        fprintf(stderr, "Bad thermal model: %s\n", optarg);
+        return 1;
+      case 'M':
+        if (parse_axis_model(optarg)) break;
+        fprintf(stderr, "Bad axis model: %s\n", optarg);
+        return 1;
+      #if ENABLED(SDIO_SUPPORT)
+        case 's': SDIO_SetImage(optarg); break;
+        case 'd': {
+          SdCardTiming timing;
+          if (!strcmp(optarg, "spi")) timing = SD_TIMING_SPI;
+          else if (!strcmp(optarg, "sdio")) timing = SD_TIMING_SDIO;
+          else if (!strcmp(optarg, "none")) timing = SD_TIMING_NONE;
+          else if (sscanf(optarg, "%u,%u,%u", &timing.read_latency_us, &timing.write_latency_us, &timing.bytes_per_s) != 3) {
+            fprintf(stderr, "Unknown SD card timing: %s\n", optarg);
+            return 1;
+          }
+          SDIO_SetTiming(timing);
+        } break;
+      #endif
+      default:
+        fprintf(stderr, "Usage: %s [-C dir] [-p] [-b] [-r sec] [-s image] [-d spi|sdio|none|r_us,w_us,bytes_s]"
+                        " [-a ambient] [-H model] [-B model] [-M axis=model]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  if (!(pty0 ? port0.open_pty("ttyMarlin0") : port0.open_stdio())) return 1;
+  #if NUM_SERIAL > 1
+    if (!port1.open_pty("ttyMarlin1")) return 1;
+  #endif
+
+  Clock::setFrequency(F_CPU);
+  Clock::setTimeMultiplier(1.0); // some testing at 10x
+
+  block_timer_signals(true);
+  port0.start();
+  #if NUM_SERIAL > 1
+    port1.start();
+  #endif
+  std::thread simulation (simulation_loop);
+  block_timer_signals(false);
 
   #if NUM_SERIAL > 0
     MYSERIAL0.begin(BAUDRATE);
@@ -114,24 +303,14 @@ int main() {
     SERIAL_FLUSHTX();
   #endif
 
-  Clock::setFrequency(F_CPU);
-  Clock::setTimeMultiplier(1.0); // some testing at 10x
-
   HAL_timer_init();
 
-  std::thread simulation (simulation_loop);
-
   DELAY_US(10000);
 
   setup();
-  for (;;) {
-    loop();
-    std::this_thread::yield();
-  }
+  for (;;) loop();
 
   simulation.join();
-  write_serial.join();
-  read_serial.join();
 }
 
 #endif // __PLAT_LINUX__
@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SDIO_SUPPORT)
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "hardware/Clock.h"
+#include "sdio.h"
+
+#define SD_BLOCK_SIZE 512
+
+static const char *image_path = "sdcard.img";
+static int image_fd = -1;
+static SdCardTiming card_timing = SD_TIMING_SPI;
+
+static uint32_t blocks_read, blocks_written;
+static uint64_t busy_us;
+
+void SDIO_SetImage(const char *path) { image_path = path; }
+void SDIO_SetTiming(const SdCardTiming &timing) { card_timing = timing; }
+
+void SDIO_Report(FILE *out) {
+  fprintf(out, "sd: %u blocks read, %u written, %.1f ms busy\n", blocks_read, blocks_written, busy_us / 1000.0f);
+  blocks_read = blocks_written = 0;
+  busy_us = 0;
+}
+
+// Stall like a blocking transfer. Timer interrupts still run meanwhile.
+static void card_access(const uint32_t latency_us) {
+  uint64_t us = latency_us;
+  if (card_timing.bytes_per_s) us += SD_BLOCK_SIZE * 1000000ULL / card_timing.bytes_per_s;
+  busy_us += us;
+  if (us) Clock::delayMicros(us);
+}
+
+// Reopen the image on each init (M21) so it can be replaced while released (M22)
+bool SDIO_Init() {
+  if (image_fd >= 0) close(image_fd);
+  image_fd = open(image_path, O_RDWR);
+  return image_fd >= 0;
+}
+
+bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
+  if (image_fd < 0) return false;
+  card_access(card_timing.read_latency_us);
+  blocks_read++;
+  return pread(image_fd, dst, SD_BLOCK_SIZE, off_t(block) * SD_BLOCK_SIZE) == SD_BLOCK_SIZE;
+}
+
+bool SDIO_WriteBlock(uint32_t block, const uint8_t *src) {
+  if (image_fd < 0) return false;
+  card_access(card_timing.write_latency_us);
+  blocks_written++;
+  return pwrite(image_fd, src, SD_BLOCK_SIZE, off_t(block) * SD_BLOCK_SIZE) == SD_BLOCK_SIZE;
+}
+
+#endif // SDIO_SUPPORT
+#endif // __PLAT_LINUX__
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * The SD card of the Linux target is a FAT disk image file.
+ * Each block access stalls the caller for as long as a real card would take.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+struct SdCardTiming {
+  uint32_t read_latency_us,   // Command to start of data
+           write_latency_us,  // Command plus the card's programming busy time
+           bytes_per_s;       // Data transfer rate, 0 for no transfer time
+};
+
+#define SD_TIMING_SPI  { 300, 800,  1000000 } // SPI at 8MHz
+#define SD_TIMING_SDIO { 100, 500, 12000000 } // 4-bit SDIO at 24MHz
+#define SD_TIMING_NONE {   0,   0,        0 }
+
+void SDIO_SetImage(const char *path);
+void SDIO_SetTiming(const SdCardTiming &timing);
+
+// Print block counts and time spent waiting on the card since the last report
+void SDIO_Report(FILE *out);
@@ -85,7 +85,7 @@ uint8_t L6470_transfer(uint8_t data, int16_t ss_pin, const uint8_t chain_positio
   // first device in chain has data sent last
   extDigitalWrite(ss_pin, LOW);
 
-  for (uint8_t i = L6470::chain[0]; (i >= 1) && !spi_abort; i--) {    // stop sending data if spi_abort is active
+  for (uint8_t i = L6470::chain[0]; (i >= 1) && !L6470.spi_abort; i--) {    // stop sending data if spi_abort is active
     DISABLE_ISRS();  // disable interrupts during SPI transfer (can't allow partial command to chips)
     uint8_t temp = L6470_SpiTransfer_Mode_3(uint8_t(i == chain_position ? data : dSPIN_NOP));
     ENABLE_ISRS();  // enable interrupts
@@ -97,19 +97,60 @@ uint8_t L6470_transfer(uint8_t data, int16_t ss_pin, const uint8_t chain_positio
 }
 
 void L6470_transfer(uint8_t L6470_buf[], const uint8_t length) {
-  // first device in chain has data sent last
+  // first device in chain has data sent last, and each device's reply is stored in its place
 
-  if (spi_active) {                    // interrupted SPI transfer so need to
+  if (L6470.spi_active) {              // interrupted SPI transfer so need to
     WRITE(L6470_CHAIN_SS_PIN, HIGH);   // guarantee min high of 650nS
     DELAY_US(1);
   }
 
   WRITE(L6470_CHAIN_SS_PIN, LOW);
   for (uint8_t i = length; i >= 1; i--)
-    L6470_SpiTransfer_Mode_3(uint8_t(L6470_buf[i]));
+    L6470_buf[i] = L6470_SpiTransfer_Mode_3(uint8_t(L6470_buf[i]));
   WRITE(L6470_CHAIN_SS_PIN, HIGH);
 }
 
+// Same as above, for use outside the stepper ISR. Each byte goes out with interrupts
+// off (can't allow partial command to chips) and sending stops if spi_abort is set.
+static void L6470_transfer_main(uint8_t L6470_buf[], const uint8_t length) {
+  if (L6470.spi_active) {              // guarantee min high of 650nS between transfers
+    WRITE(L6470_CHAIN_SS_PIN, HIGH);
+    DELAY_US(1);
+  }
+
+  WRITE(L6470_CHAIN_SS_PIN, LOW);
+  for (uint8_t i = length; (i >= 1) && !L6470.spi_abort; i--) {
+    DISABLE_ISRS();
+    L6470_buf[i] = L6470_SpiTransfer_Mode_3(uint8_t(L6470_buf[i]));
+    ENABLE_ISRS();
+  }
+  WRITE(L6470_CHAIN_SS_PIN, HIGH);
+}
+
+/**
+ * Read the status of every chip in the chain at once: GET_STATUS, then one
+ * NOP round for each status byte. status[] is indexed by chain position.
+ * Return false if the stepper ISR sent direction commands in between, since
+ * the replies are then garbage. Call with spi_active set.
+ */
+bool L6470_get_chain_status(uint16_t status[], const uint8_t length) {
+  uint8_t L6470_buf[MAX_L6470 + 1];
+  for (uint8_t j = 1; j <= length; j++) L6470_buf[j] = dSPIN_GET_STATUS;
+  L6470_transfer_main(L6470_buf, length);
+  if (L6470.spi_abort) return false;
+
+  for (uint8_t j = 1; j <= length; j++) L6470_buf[j] = dSPIN_NOP;
+  L6470_transfer_main(L6470_buf, length);
+  if (L6470.spi_abort) return false;
+
+  for (uint8_t j = 1; j <= length; j++) { status[j] = uint16_t(L6470_buf[j]) << 8; L6470_buf[j] = dSPIN_NOP; }
+  L6470_transfer_main(L6470_buf, length);
+  if (L6470.spi_abort) return false;
+
+  for (uint8_t j = 1; j <= length; j++) status[j] |= L6470_buf[j];
+  return true;
+}
+
 void L6470_spi_init() {
   OUT_WRITE(L6470_CHAIN_SS_PIN, HIGH);
   OUT_WRITE(L6470_CHAIN_SCK_PIN, HIGH);
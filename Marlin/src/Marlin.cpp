@@ -173,6 +173,14 @@
   #include "feature/prusa_MMU2/mmu2.h"
 #endif
 
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #include "feature/tool_preheat.h"
+#endif
+
+#if ENABLED(BINARY_TELEMETRY)
+  #include "feature/binary_telemetry.h"
+#endif
+
 #if ENABLED(EXTENSIBLE_UI)
   #include "lcd/extensible_ui/ui_api.h"
 #endif
@@ -664,6 +672,37 @@ void manage_inactivity(const bool ignore_stepper_queue/*=false*/) {
   #endif
 }
 
+#if ENABLED(IDLE_DEFER_LOW_PRIORITY)
+
+  /**
+   * Return true if cosmetic tasks should be skipped on this pass of idle().
+   * That's while the planner is moving but running low on blocks, so the
+   * main loop can get back to queuing moves. Deferred tasks still get a
+   * pass at least every IDLE_DEFER_MAX_MS.
+   */
+  inline bool idle_defer_low_priority() {
+    static millis_t next_forced_ms; // = 0
+    static bool deferring; // = false
+
+    if (!planner.has_blocks_queued() || planner.movesplanned() >= IDLE_DEFER_MIN_BLOCKS) {
+      deferring = false;
+      return false;
+    }
+
+    const millis_t ms = millis();
+    if (!deferring) {
+      deferring = true;
+      next_forced_ms = ms + IDLE_DEFER_MAX_MS;
+    }
+    else if (ELAPSED(ms, next_forced_ms)) {
+      next_forced_ms = ms + IDLE_DEFER_MAX_MS;
+      return false;
+    }
+    return true;
+  }
+
+#endif
+
 /**
  * Standard idle routine keeps the machine alive
  */
@@ -687,11 +726,17 @@ void idle(
     }
   #endif
 
+  #if ENABLED(IDLE_DEFER_LOW_PRIORITY)
+    const bool run_low_priority = !idle_defer_low_priority();
+  #else
+    constexpr bool run_low_priority = true;
+  #endif
+
   #if ENABLED(MAX7219_DEBUG)
-    max7219.idle_tasks();
+    if (run_low_priority) max7219.idle_tasks();
   #endif
 
-  ui.update();
+  ui.update(run_low_priority); // Poll inputs always, redraw only when not deferring
 
   #if ENABLED(HOST_KEEPALIVE_FEATURE)
     gcode.host_keepalive();
@@ -705,8 +750,12 @@ void idle(
 
   thermalManager.manage_heater();
 
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    tool_preheat.update();
+  #endif
+
   #if ENABLED(PRINTCOUNTER)
-    print_job_timer.tick();
+    if (run_low_priority) print_job_timer.tick();
   #endif
 
   #if USE_BEEPER
@@ -714,14 +763,8 @@ void idle(
   #endif
 
   #if ENABLED(I2C_POSITION_ENCODERS)
-    static millis_t i2cpem_next_update_ms;
-    if (planner.has_blocks_queued()) {
-      const millis_t ms = millis();
-      if (ELAPSED(ms, i2cpem_next_update_ms)) {
-        I2CPEM.update();
-        i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
-      }
-    }
+    // Each encoder is checked every I2CPE_MIN_UPD_TIME_MS, one I2C read per call
+    if (planner.has_blocks_queued()) I2CPEM.update();
   #endif
 
   #ifdef HAL_IDLETASK
@@ -729,13 +772,16 @@ void idle(
   #endif
 
   #if HAS_AUTO_REPORTING
-    if (!suspend_auto_report) {
+    if (run_low_priority && !suspend_auto_report) {
       #if ENABLED(AUTO_REPORT_TEMPERATURES)
         thermalManager.auto_report_temperatures();
       #endif
       #if ENABLED(AUTO_REPORT_SD_STATUS)
         card.auto_report_sd_status();
       #endif
+      #if ENABLED(BINARY_TELEMETRY)
+        binary_telemetry.auto_report();
+      #endif
     }
   #endif
 
@@ -971,7 +1017,7 @@ void setup() {
   #endif
 
   SERIAL_ECHO_START();
-  SERIAL_ECHOLNPAIR(MSG_FREE_MEMORY, freeMemory(), MSG_PLANNER_BUFFER_BYTES, (int)sizeof(block_t) * (BLOCK_BUFFER_SIZE));
+  SERIAL_ECHOLNPAIR(MSG_FREE_MEMORY, freeMemory(), MSG_PLANNER_BUFFER_BYTES, (int)sizeof(block_t) * (BLOCK_BUFFER_SIZE), MSG_PLANNER_BLOCK_BYTES, (int)sizeof(block_t));
 
   // UI must be initialized before EEPROM
   // (because EEPROM code calls the UI).
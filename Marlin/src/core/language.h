@@ -154,6 +154,7 @@
 #define MSG_CONFIGURATION_VER               " Last Updated: "
 #define MSG_FREE_MEMORY                     " Free Memory: "
 #define MSG_PLANNER_BUFFER_BYTES            "  PlannerBufferBytes: "
+#define MSG_PLANNER_BLOCK_BYTES             " PlannerBlockBytes: "
 #define MSG_OK                              "ok"
 #define MSG_WAIT                            "wait"
 #define MSG_STATS                           "Stats: "
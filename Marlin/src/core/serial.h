@@ -175,6 +175,7 @@ inline void serial_echopair_PGM(PGM_P const s_P, uint8_t v) { serial_echopair_PG
 inline void serial_echopair_PGM(PGM_P const s_P, bool v)    { serial_echopair_PGM(s_P, (int)v); }
 inline void serial_echopair_PGM(PGM_P const s_P, void *v)   { serial_echopair_PGM(s_P, (unsigned long)v); }
 
+void serial_print_float(const float &f, const uint8_t digits=2);
 void serialprintPGM(PGM_P str);
 void serial_echo_start();
 void serial_error_start();
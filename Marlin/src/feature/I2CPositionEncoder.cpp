@@ -53,10 +53,20 @@ void I2CPositionEncoder::init(const uint8_t address, const AxisEnum axis) {
   position = get_position();
 }
 
-void I2CPositionEncoder::update() {
-  if (!initialized || !homed || !active) return; //check encoder is set up and active
+// Babysteps from an earlier correction that haven't moved the axis yet
+static bool babysteps_pending() {
+  LOOP_L_N(i, COUNT(babystep.steps)) if (babystep.steps[i]) return true;
+  return false;
+}
 
-  position = get_position();
+bool I2CPositionEncoder::update() {
+  if (!initialized || !homed || !active) return false; //check encoder is set up and active
+
+  // Take the count and the stepper position together. Reports read the
+  // encoder on their own and leave this sample alone.
+  position = get_raw_count(&sampleSteps) - zeroOffset;
+  sampleTime = millis();
+  nextUpdateTime = sampleTime + I2CPE_MIN_UPD_TIME_MS;
 
   //we don't want to stop things just because the encoder missed a message,
   //so we only care about responses that indicate bad magnetic strength
@@ -69,7 +79,7 @@ void I2CPositionEncoder::update() {
       SERIAL_ECHOLMPAIR("Fault detected on ", axis_codes[encoderAxis], " axis encoder. Disengaging error correction until module is trusted again.");
     }
     */
-    return;
+    return true;
   }
 
   if (!trusted) {
@@ -112,17 +122,16 @@ void I2CPositionEncoder::update() {
         #endif
       }
     */
-    return;
+    return true;
   }
 
-  lastPosition = position;
-  const millis_t positionTime = millis();
+  const millis_t positionTime = sampleTime;
 
-  //only do error correction if setup and enabled
-  if (ec && ecMethod != I2CPE_ECM_NONE) {
+  //only do error correction if setup and enabled, and the last correction is done
+  if (ec && ecMethod != I2CPE_ECM_NONE && !babysteps_pending()) {
 
     #ifdef I2CPE_EC_THRESH_PROPORTIONAL
-      const millis_t deltaTime = positionTime - lastPositionTime;
+      const millis_t deltaTime = _MAX(positionTime - lastPositionTime, millis_t(1));
       const uint32_t distance = ABS(position - lastPosition),
                      speed = distance / deltaTime;
       const float threshold = constrain((speed / 50), 1, 50) * ecThreshold;
@@ -196,7 +205,9 @@ void I2CPositionEncoder::update() {
     }
   }
 
+  lastPosition = position;
   lastPositionTime = positionTime;
+  return true;
 }
 
 void I2CPositionEncoder::set_homed() {
@@ -278,7 +289,8 @@ int32_t I2CPositionEncoder::get_axis_error_steps(const bool report) {
   //convert both 'ticks' into same units / base
   encoderCountInStepperTicksScaled = LROUND((stepperTicksPerUnit * encoderTicks) / encoderTicksPerUnit);
 
-  int32_t target = stepper.position(encoderAxis),
+  // Compare against the stepper position at the time the count was read
+  int32_t target = sampleSteps,
           error = (encoderCountInStepperTicksScaled - target);
 
   //suppress discontinuities (might be caused by bad I2C readings...?)
@@ -295,13 +307,18 @@ int32_t I2CPositionEncoder::get_axis_error_steps(const bool report) {
   return (suppressOutput ? 0 : error);
 }
 
-int32_t I2CPositionEncoder::get_raw_count() {
+int32_t I2CPositionEncoder::get_raw_count(int32_t * const steps/*=nullptr*/) {
   uint8_t index = 0;
   i2cLong encoderCount;
 
   encoderCount.val = 0x00;
 
-  if (Wire.requestFrom((int)i2cAddress, 3) != 3) {
+  // The axis keeps moving during the transfer, so use the step count midway through it
+  const int32_t stepsBefore = steps ? stepper.position(encoderAxis) : 0;
+  const uint8_t received = Wire.requestFrom((int)i2cAddress, 3);
+  if (steps) *steps = stepsBefore + (stepper.position(encoderAxis) - stepsBefore) / 2;
+
+  if (received != 3) {
     //houston, we have a problem...
     H = I2CPE_MAG_SIG_NF;
     return 0;
@@ -469,6 +486,10 @@ uint8_t I2CPositionEncodersMgr::I2CPE_addr,
         I2CPositionEncodersMgr::I2CPE_idx;
 I2CPositionEncoder I2CPositionEncodersMgr::encoders[I2CPE_ENCODER_CNT];
 
+#if I2CPE_ENCODER_CNT > 1
+  uint8_t I2CPositionEncodersMgr::next_update_idx; // = 0
+#endif
+
 void I2CPositionEncodersMgr::init() {
   Wire.begin();
 
@@ -125,9 +125,12 @@ class I2CPositionEncoder {
 
     int32_t   zeroOffset          = 0,
               lastPosition        = 0,
-              position;
+              position,
+              sampleSteps         = 0;                   // Stepper position when the last count was read
 
-    millis_t  lastPositionTime    = 0,
+    millis_t  sampleTime          = 0,                   // Time when the last count was read
+              nextUpdateTime      = 0,                   // Time of the next check
+              lastPositionTime    = 0,
               nextErrorCountTime  = 0,
               lastErrorTime;
 
@@ -141,12 +144,13 @@ class I2CPositionEncoder {
     void init(const uint8_t address, const AxisEnum axis);
     void reset();
 
-    void update();
+    bool update();
+    FORCE_INLINE bool update_due(const millis_t ms) { return ELAPSED(ms, nextUpdateTime); }
 
     void set_homed();
     void set_unhomed();
 
-    int32_t get_raw_count();
+    int32_t get_raw_count(int32_t * const steps=nullptr);
 
     FORCE_INLINE float mm_from_count(const int32_t count) {
       switch (type) {
@@ -217,12 +221,27 @@ class I2CPositionEncodersMgr {
     static bool I2CPE_anyaxis;
     static uint8_t I2CPE_addr, I2CPE_idx;
 
+    #if I2CPE_ENCODER_CNT > 1
+      static uint8_t next_update_idx;
+    #endif
+
   public:
 
     static void init();
 
-    // consider only updating one endoder per call / tick if encoders become too time intensive
-    static void update() { LOOP_PE(i) encoders[i].update(); }
+    // Check the next encoder that's due, so a single I2C read is all that idle() waits on
+    static void update() {
+      const millis_t ms = millis();
+      #if I2CPE_ENCODER_CNT > 1
+        LOOP_PE(n) {
+          I2CPositionEncoder &enc = encoders[next_update_idx];
+          if (++next_update_idx >= I2CPE_ENCODER_CNT) next_update_idx = 0;
+          if (enc.update_due(ms) && enc.update()) return;
+        }
+      #else
+        if (encoders[0].update_due(ms)) encoders[0].update();
+      #endif
+    }
 
     static void homed(const AxisEnum axis) {
       LOOP_PE(i)
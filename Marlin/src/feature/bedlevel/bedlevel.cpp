@@ -60,6 +60,35 @@ bool leveling_is_valid() {
   ;
 }
 
+inline bool can_change_leveling(const bool enable) {
+  return enable != planner.leveling_active
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      && (!enable || leveling_is_valid())
+    #endif
+  ;
+}
+
+inline void change_leveling(const bool enable) {
+  #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    // Force bilinear_z_offset to re-calculate next time
+    const float reset[XYZ] = { -9999.999, -9999.999, 0 };
+    (void)bilinear_z_offset(reset);
+  #endif
+
+  if (planner.leveling_active) {      // leveling from on to off
+    // change unleveled current_position to physical current_position without moving steppers.
+    planner.apply_leveling(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS]);
+    planner.leveling_active = false;  // disable only AFTER calling apply_leveling
+  }
+  else {                              // leveling from off to on
+    planner.leveling_active = true;   // enable BEFORE calling unapply_leveling, otherwise ignored
+    // change physical current_position to unleveled current_position without moving steppers.
+    planner.unapply_leveling(current_position);
+  }
+
+  sync_plan_position();
+}
+
 /**
  * Turn bed leveling on or off, fixing the current
  * position as-needed.
@@ -68,42 +97,29 @@ bool leveling_is_valid() {
  *  Enable: Current position = "unleveled" physical position
  */
 void set_bed_leveling_enabled(const bool enable/*=true*/) {
-
-  #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-    const bool can_change = (!enable || leveling_is_valid());
-  #else
-    constexpr bool can_change = true;
-  #endif
-
-  if (can_change && enable != planner.leveling_active) {
-
+  if (can_change_leveling(enable)) {
     planner.synchronize();
-
-    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-      // Force bilinear_z_offset to re-calculate next time
-      const float reset[XYZ] = { -9999.999, -9999.999, 0 };
-      (void)bilinear_z_offset(reset);
-    #endif
-
-    if (planner.leveling_active) {      // leveling from on to off
-      // change unleveled current_position to physical current_position without moving steppers.
-      planner.apply_leveling(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS]);
-      planner.leveling_active = false;  // disable only AFTER calling apply_leveling
-    }
-    else {                              // leveling from off to on
-      planner.leveling_active = true;   // enable BEFORE calling unapply_leveling, otherwise ignored
-      // change physical current_position to unleveled current_position without moving steppers.
-      planner.unapply_leveling(current_position);
-    }
-
-    sync_plan_position();
+    change_leveling(enable);
   }
 }
 
+/**
+ * For tool_change() only. Leveling is applied as moves are planned and the
+ * new position goes to the stepper as a sync block, so the change can take
+ * effect in order with the tool change moves without draining the planner.
+ */
+void queue_bed_leveling_enabled(const bool enable) {
+  if (can_change_leveling(enable)) change_leveling(enable);
+}
+
 TemporaryBedLevelingState::TemporaryBedLevelingState(const bool enable) : saved(planner.leveling_active) {
   set_bed_leveling_enabled(enable);
 }
 
+QueuedBedLevelingState::QueuedBedLevelingState(const bool enable) : saved(planner.leveling_active) {
+  queue_bed_leveling_enabled(enable);
+}
+
 #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
 
   void set_z_fade_height(const float zfh, const bool do_report/*=true*/) {
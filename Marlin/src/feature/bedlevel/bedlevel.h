@@ -31,6 +31,7 @@
 
 bool leveling_is_valid();
 void set_bed_leveling_enabled(const bool enable=true);
+void queue_bed_leveling_enabled(const bool enable);
 void reset_bed_level();
 
 #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
@@ -53,6 +54,17 @@ class TemporaryBedLevelingState {
 };
 #define TEMPORARY_BED_LEVELING_STATE(enable) const TemporaryBedLevelingState tbls(enable)
 
+/**
+ * The same, without waiting for the planner. For tool_change() only.
+ */
+class QueuedBedLevelingState {
+  bool saved;
+  public:
+    QueuedBedLevelingState(const bool enable);
+    ~QueuedBedLevelingState() { queue_bed_leveling_enabled(saved); }
+};
+#define QUEUED_BED_LEVELING_STATE(enable) const QueuedBedLevelingState qbls(enable)
+
 #if HAS_MESH
 
   typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
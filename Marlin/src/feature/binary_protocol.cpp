@@ -33,4 +33,22 @@ bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_tran
 
 BinaryStream binaryStream[NUM_SERIAL];
 
+uint16_t BinaryStream::frame_packet(uint8_t * const buffer, const Protocol protocol, const uint8_t type, const uint8_t tx_sync, const uint16_t size) {
+  Packet::Header &header = *reinterpret_cast<Packet::Header*>(buffer);
+  header.token = Packet::Header::HEADER_TOKEN;
+  header.sync = tx_sync;
+  header.meta = (uint8_t(protocol) << 4) | (type & 0xF);
+  header.size = size;
+
+  // The same checksums the receiver checks, over everything after the token
+  uint32_t cs = 0;
+  for (uint8_t i = 2; i < PACKET_HEADER_SIZE - 2; i++) cs = checksum(cs, buffer[i]);
+  header.checksum = cs;
+  for (uint16_t i = PACKET_HEADER_SIZE - 2; i < PACKET_HEADER_SIZE + size; i++) cs = checksum(cs, buffer[i]);
+
+  Packet::Footer &footer = *reinterpret_cast<Packet::Footer*>(&buffer[PACKET_HEADER_SIZE + size]);
+  footer.checksum = cs;
+  return PACKET_OVERHEAD + size;
+}
+
 #endif // BINARY_FILE_TRANSFER
@@ -220,7 +220,7 @@ public:
 
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, TELEMETRY };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -278,7 +278,7 @@ public:
   }
 
   // fletchers 16 checksum
-  uint32_t checksum(uint32_t cs, uint8_t value) {
+  static uint32_t checksum(uint32_t cs, uint8_t value) {
     uint16_t cs_low = (((cs & 0xFF) + value) % 255);
     return ((((cs >> 8) + cs_low) % 255) << 8)  | cs_low;
   }
@@ -441,6 +441,13 @@ public:
     }
   }
 
+  /**
+   * Frame an outgoing packet in place. The payload is at buffer[PACKET_HEADER_SIZE]
+   * and the footer follows it. Return the full packet size.
+   */
+  static constexpr uint8_t PACKET_HEADER_SIZE = sizeof(Packet::Header), PACKET_OVERHEAD = sizeof(Packet::Header) + sizeof(Packet::Footer);
+  static uint16_t frame_packet(uint8_t * const buffer, const Protocol protocol, const uint8_t type, const uint8_t tx_sync, const uint16_t size);
+
   void dispatch() {
     switch(static_cast<Protocol>(packet.header.protocol())) {
       case Protocol::CONTROL:
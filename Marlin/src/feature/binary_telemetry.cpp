@@ -0,0 +1,152 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/binary_telemetry.cpp - Binary auto-report frames
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_TELEMETRY)
+
+#include "binary_telemetry.h"
+
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../gcode/queue.h"
+#include "../sd/cardreader.h"
+#include "binary_protocol.h"
+
+#define TELEMETRY_FIELDS    8
+#define TELEMETRY_SNAPSHOT  (HOTENDS * 5 + 5 + 5 + XYZE * 4 + 2 + 8)
+
+BinaryTelemetry binary_telemetry;
+
+uint16_t BinaryTelemetry::interval_ms;  // = 0
+millis_t BinaryTelemetry::next_report_ms,
+         BinaryTelemetry::next_keyframe_ms;
+uint8_t BinaryTelemetry::tx_sync;
+#if NUM_SERIAL > 1
+  int8_t BinaryTelemetry::port;
+#endif
+
+static uint8_t last_snapshot[TELEMETRY_SNAPSHOT];
+
+static uint8_t* put_int16(uint8_t *p, const int16_t v) { *p++ = v; *p++ = v >> 8; return p; }
+static uint8_t* put_int32(uint8_t *p, const int32_t v) { p = put_int16(p, v); return put_int16(p, v >> 16); }
+static uint8_t* put_temp(uint8_t *p, const float &c) { return put_int16(p, LROUND(c * 10)); }
+
+/**
+ * Set the time between frames, or 0 to stop. Frames go to
+ * the port that sent the command, starting with a complete frame.
+ */
+void BinaryTelemetry::set_interval(const uint16_t ms) {
+  interval_ms = ms;
+  next_report_ms = next_keyframe_ms = millis();
+  #if NUM_SERIAL > 1
+    port = serial_port_index;
+  #endif
+}
+
+void BinaryTelemetry::auto_report() {
+  if (!interval_ms) return;
+  const millis_t ms = millis();
+  if (PENDING(ms, next_report_ms)) return;
+  next_report_ms = ms + interval_ms;
+
+  // Take a snapshot of all fields, noting where each one ends
+  uint8_t snapshot[TELEMETRY_SNAPSHOT], *p = snapshot, field_end[TELEMETRY_FIELDS], f = 0;
+
+  HOTEND_LOOP() p = put_temp(p, thermalManager.degHotend(e));
+  field_end[f++] = p - snapshot;
+  HOTEND_LOOP() p = put_int16(p, thermalManager.degTargetHotend(e));
+  field_end[f++] = p - snapshot;
+  HOTEND_LOOP() *p++ = thermalManager.getHeaterPower((heater_ind_t)e);
+  field_end[f++] = p - snapshot;
+
+  #if HAS_HEATED_BED
+    p = put_temp(p, thermalManager.degBed());
+    p = put_int16(p, thermalManager.degTargetBed());
+    *p++ = thermalManager.getHeaterPower(H_BED);
+  #else
+    p = put_int16(p, 0); p = put_int16(p, 0); *p++ = 0;
+  #endif
+  field_end[f++] = p - snapshot;
+
+  #if HAS_TEMP_CHAMBER
+    p = put_temp(p, thermalManager.degChamber());
+  #else
+    p = put_int16(p, 0);
+  #endif
+  #if HAS_HEATED_CHAMBER
+    p = put_int16(p, thermalManager.degTargetChamber());
+    *p++ = thermalManager.getHeaterPower(H_CHAMBER);
+  #else
+    p = put_int16(p, 0); *p++ = 0;
+  #endif
+  field_end[f++] = p - snapshot;
+
+  p = put_int32(p, LROUND(LOGICAL_X_POSITION(current_position[X_AXIS]) * 1000));
+  p = put_int32(p, LROUND(LOGICAL_Y_POSITION(current_position[Y_AXIS]) * 1000));
+  p = put_int32(p, LROUND(LOGICAL_Z_POSITION(current_position[Z_AXIS]) * 1000));
+  p = put_int32(p, LROUND(current_position[E_AXIS] * 1000));
+  field_end[f++] = p - snapshot;
+
+  *p++ = planner.movesplanned();
+  *p++ = queue.length;
+  field_end[f++] = p - snapshot;
+
+  const bool sd_open = card.isFileOpen();
+  p = put_int32(p, sd_open ? card.getIndex() : 0);
+  p = put_int32(p, sd_open ? card.getFileSize() : 0);
+  field_end[f++] = p - snapshot;
+
+  // Copy the changed fields, or all of them for a key frame
+  const bool keyframe = ELAPSED(ms, next_keyframe_ms);
+  if (keyframe) next_keyframe_ms = ms + 1000UL * (BINARY_TELEMETRY_KEYFRAME);
+
+  uint8_t frame[BinaryStream::PACKET_OVERHEAD + 2 + TELEMETRY_SNAPSHOT];
+  uint8_t * const payload = &frame[BinaryStream::PACKET_HEADER_SIZE], *out = payload + 2;
+  uint16_t mask = 0;
+  for (uint8_t i = 0, start = 0; i < TELEMETRY_FIELDS; start = field_end[i++]) {
+    const uint8_t len = field_end[i] - start;
+    if (keyframe || memcmp(&snapshot[start], &last_snapshot[start], len)) {
+      SBI(mask, i);
+      memcpy(out, &snapshot[start], len);
+      out += len;
+    }
+  }
+  if (!mask) return;
+  COPY(last_snapshot, snapshot);
+  put_int16(payload, mask);
+
+  const uint16_t size = BinaryStream::frame_packet(frame, BinaryStream::Protocol::TELEMETRY,
+    keyframe ? FRAME_KEY : FRAME_DELTA, tx_sync++, out - payload);
+
+  #if NUM_SERIAL > 1
+    PORT_REDIRECT(port);
+  #endif
+  SERIAL_OUT(write, frame, size);
+}
+
+#endif // BINARY_TELEMETRY
@@ -0,0 +1,62 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/binary_telemetry.h - Binary auto-report frames
+ *
+ * Temperatures, position, queue depth and SD progress are sent as
+ * BinaryStream packets on the port that enabled them with M155 B.
+ * Each frame begins with a mask of the fields it contains. Only changed
+ * fields are sent, with a complete frame every BINARY_TELEMETRY_KEYFRAME
+ * seconds so a host can pick up the stream at any time.
+ *
+ * Fields, little-endian, in mask bit order:
+ *   0 Hotend temperatures  int16 x HOTENDS  (0.1°C)
+ *   1 Hotend targets       int16 x HOTENDS  (°C)
+ *   2 Hotend power         uint8 x HOTENDS  (0-127)
+ *   3 Bed                  int16 temp (0.1°C), int16 target, uint8 power
+ *   4 Chamber              int16 temp (0.1°C), int16 target, uint8 power
+ *   5 Position             int32 x XYZE     (µm)
+ *   6 Queue                uint8 planner blocks, uint8 commands
+ *   7 SD progress          uint32 position, uint32 file size
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class BinaryTelemetry {
+  public:
+    enum TelemetryType : uint8_t { FRAME_KEY, FRAME_DELTA };
+
+    static void set_interval(const uint16_t ms);
+    static void auto_report();
+
+  private:
+    static uint16_t interval_ms;
+    static millis_t next_report_ms, next_keyframe_ms;
+    static uint8_t tx_sync;
+    #if NUM_SERIAL > 1
+      static int8_t port;
+    #endif
+};
+
+extern BinaryTelemetry binary_telemetry;
@@ -42,6 +42,31 @@ Adafruit_NeoPixel Marlin_NeoPixel::adaneo1(NEOPIXEL_PIXELS, NEOPIXEL_PIN, NEOPIX
   #endif
 ;
 
+bool Marlin_NeoPixel::dirty; // = false
+
+#ifdef NEOPIXEL_SPI_PORT
+
+  #include <SPI.h>
+  #include "neopixel_encode.h"
+
+  // The strip is driven from the MOSI pin of its own SPI port. Adafruit_NeoPixel
+  // still holds the pixel data, but the frame goes out by DMA instead of
+  // bit-banging with interrupts disabled.
+  static SPIClass neo_spi(NEOPIXEL_SPI_PORT);
+  static uint8_t neo_spi_buffer[NEO_SPI_FRAME_SIZE((NEOPIXEL_PIXELS) * (NEOPIXEL_BYTES_PER_PIXEL))];
+
+  void Marlin_NeoPixel::spi_begin() {
+    neo_spi.beginTransaction(SPISettings(NEO_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+  }
+
+  void Marlin_NeoPixel::spi_show() {
+    neo_spi.dmaSendAsync(nullptr, 0); // Wait for the previous frame, if still sending
+    const uint16_t len = neo_spi_encode(adaneo1.getPixels(), pixels() * (NEOPIXEL_BYTES_PER_PIXEL), neo_spi_buffer);
+    neo_spi.dmaSendAsync(neo_spi_buffer, len);
+  }
+
+#endif
+
 #ifdef NEOPIXEL_BKGD_LED_INDEX
 
   void Marlin_NeoPixel::set_color_background() {
@@ -33,6 +33,7 @@
 
 #include <Adafruit_NeoPixel.h>
 #include <stdint.h>
+#include <string.h>
 
 // ------------------------
 // Defines
@@ -42,6 +43,7 @@
 
 #define NEOPIXEL_IS_RGB  (NEOPIXEL_TYPE == NEO_RGB || NEOPIXEL_TYPE == NEO_RBG || NEOPIXEL_TYPE == NEO_GRB || NEOPIXEL_TYPE == NEO_GBR || NEOPIXEL_TYPE == NEO_BRG || NEOPIXEL_TYPE == NEO_BGR)
 #define NEOPIXEL_IS_RGBW !NEOPIXEL_IS_RGB
+#define NEOPIXEL_BYTES_PER_PIXEL (NEOPIXEL_IS_RGBW ? 4 : 3)
 
 #if NEOPIXEL_IS_RGB
   #define NEO_WHITE 255, 255, 255, 0
@@ -61,6 +63,16 @@ private:
     #endif
   ;
 
+  // Set when the pixel data differs from what was last sent. Sending
+  // the strip disables interrupts for ~30µs per pixel, so don't resend
+  // a frame that hasn't changed.
+  static bool dirty;
+
+  #ifdef NEOPIXEL_SPI_PORT
+    static void spi_begin();
+    static void spi_show();
+  #endif
+
 public:
   static void init();
   static void set_color_startup(const uint32_t c);
@@ -74,20 +86,31 @@ public:
   #endif
 
   static inline void begin() {
-    adaneo1.begin();
+    dirty = true;
+    #ifdef NEOPIXEL_SPI_PORT
+      spi_begin();
+    #else
+      adaneo1.begin();
+    #endif
     #if MULTIPLE_NEOPIXEL_TYPES
       adaneo2.begin();
     #endif
   }
 
   static inline void set_pixel_color(const uint16_t n, const uint32_t c) {
+    if (n >= pixels()) return;
+    // Both strips get the same colors, so the first one tells if anything changed
+    uint8_t * const p = adaneo1.getPixels() + n * (NEOPIXEL_BYTES_PER_PIXEL), old[NEOPIXEL_BYTES_PER_PIXEL];
+    memcpy(old, p, sizeof(old));
     adaneo1.setPixelColor(n, c);
+    if (memcmp(old, p, sizeof(old))) dirty = true;
     #if MULTIPLE_NEOPIXEL_TYPES
       adaneo2.setPixelColor(n, c);
     #endif
   }
 
   static inline void set_brightness(const uint8_t b) {
+    if (b != brightness()) dirty = true;
     adaneo1.setBrightness(b);
     #if MULTIPLE_NEOPIXEL_TYPES
       adaneo2.setBrightness(b);
@@ -95,7 +118,13 @@ public:
   }
 
   static inline void show() {
-    adaneo1.show();
+    if (!dirty) return;
+    dirty = false;
+    #ifdef NEOPIXEL_SPI_PORT
+      spi_show();
+    #else
+      adaneo1.show();
+    #endif
     #if PIN_EXISTS(NEOPIXEL2)
       #if MULTIPLE_NEOPIXEL_TYPES
         adaneo2.show();
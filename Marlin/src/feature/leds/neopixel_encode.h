@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Encode NeoPixel (WS2812) frames as an SPI bitstream
+ *
+ * Each data bit becomes 3 SPI bits at NEO_SPI_CLOCK (444ns each):
+ * a 0 is sent as 100 (high 444ns) and a 1 as 110 (high 889ns), within
+ * the WS2812 timing tolerances. The frame ends with enough zero bytes
+ * to latch the strip even if the next frame follows right away.
+ *
+ * This file has no Marlin dependencies so it can be tested on the host.
+ */
+
+#include <stdint.h>
+
+#define NEO_SPI_CLOCK        2250000UL  // 72MHz / 32
+#define NEO_SPI_RESET_BYTES  90         // 320µs low to latch, enough for WS2812B-V5
+
+// SPI bytes needed to send 'N' bytes of pixel data
+#define NEO_SPI_FRAME_SIZE(N) ((N) * 3 + NEO_SPI_RESET_BYTES)
+
+/**
+ * Encode 'len' bytes of pixel data, already in wire order (e.g., GRB) and
+ * scaled for brightness, into 'dst', which must hold NEO_SPI_FRAME_SIZE(len).
+ * Return the number of bytes to send.
+ */
+inline uint16_t neo_spi_encode(const uint8_t *src, const uint16_t len, uint8_t *dst) {
+  uint8_t *d = dst;
+  for (uint16_t i = 0; i < len; i++) {
+    const uint8_t b = src[i];
+    uint32_t w = 0x924924UL;              // 100 x 8, MSB first
+    for (uint8_t n = 0; n < 8; n++)
+      if (b & (0x80 >> n)) w |= 1UL << (22 - 3 * n);
+    *d++ = uint8_t(w >> 16);
+    *d++ = uint8_t(w >> 8);
+    *d++ = uint8_t(w);
+  }
+  for (uint8_t i = 0; i < NEO_SPI_RESET_BYTES; i++) *d++ = 0;
+  return uint16_t(d - dst);
+}
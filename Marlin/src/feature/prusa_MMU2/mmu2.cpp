@@ -99,6 +99,12 @@ int16_t MMU2::version = -1, MMU2::buildnr = -1;
 millis_t MMU2::last_request, MMU2::next_P0_request;
 char MMU2::rx_buffer[16], MMU2::tx_buffer[16];
 
+#if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+  MMU2::ToolChangeState MMU2::tc_state; // = TC_IDLE
+  uint8_t MMU2::tc_tool;
+  int16_t MMU2::tc_resume_temp;
+#endif
+
 #if HAS_LCD_MENU && ENABLED(MMU2_MENUS)
 
   struct E_Step {
@@ -152,6 +158,10 @@ uint8_t MMU2::get_current_tool() {
 
 void MMU2::mmu_loop() {
 
+  #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+    if (tc_state != TC_IDLE) tool_change_loop();
+  #endif
+
   switch (state) {
 
     case 0: break;
@@ -317,8 +327,14 @@ void MMU2::mmu_loop() {
         ready = true;
         state = 1;
         last_cmd = MMU_CMD_NONE;
+        #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+          if (tc_state == TC_LOADING) tool_change_loaded();
+        #endif
       }
       else if (ELAPSED(millis(), last_request + MMU_CMD_TIMEOUT)) {
+        #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+          if (tc_state == TC_LOADING) tool_change_timeout();
+        #endif
         // resend request after timeout
         if (last_cmd) {
           DEBUG_ECHOLNPGM("MMU retry");
@@ -444,31 +460,148 @@ void MMU2::tool_change(uint8_t index) {
 
   if (!enabled) return;
 
-  set_runout_valid(false);
+  #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
 
-  if (index != extruder) {
+    // Only one tool change can wait in the planner
+    while (tc_state != TC_IDLE) idle();
 
-    disable_E0();
-    ui.status_printf_P(0, PSTR(MSG_MMU2_LOADING_FILAMENT), int(index + 1));
+    if (index != extruder) {
+      // Hold the moves that follow until the new filament is loaded.
+      // mmu_loop() starts the change when the moves ahead of it finish.
+      set_runout_valid(false);
+      tc_tool = index;
+      planner.buffer_hold_block();
+      tc_state = TC_WAIT_MOVES;
+    }
+    else
+      set_runout_valid(true);
+
+  #else
+
+    set_runout_valid(false);
+
+    if (index != extruder) {
+
+      disable_E0();
+      ui.status_printf_P(0, PSTR(MSG_MMU2_LOADING_FILAMENT), int(index + 1));
+
+      command(MMU_CMD_T0 + index);
 
-    command(MMU_CMD_T0 + index);
+      manage_response(true, true);
+
+      command(MMU_CMD_C0);
+      extruder = index; //filament change is finished
+      active_extruder = 0;
+
+      enable_E0();
+
+      SERIAL_ECHO_START();
+      SERIAL_ECHOLNPAIR(MSG_ACTIVE_EXTRUDER, int(extruder));
+
+      ui.reset_status();
+    }
+
+    set_runout_valid(true);
+
+  #endif
+}
+
+#if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+
+  /**
+   * Advance a tool change queued by tool_change(). Commands are set
+   * directly here, since command() waits for the tool change to finish.
+   */
+  void MMU2::tool_change_loop() {
+    switch (tc_state) {
+      default: break;
+
+      case TC_WAIT_MOVES:
+        // Moves with the current filament are done
+        if (planner.hold_reached()) {
+          disable_E0();
+          ui.status_printf_P(0, PSTR(MSG_MMU2_LOADING_FILAMENT), int(tc_tool + 1));
+          mmu_print_saved = false;
+          cmd = MMU_CMD_T0 + tc_tool;
+          ready = false;
+          tc_state = TC_LOADING;
+        }
+        // The planner was cleared by quick_stop() or an abort, taking the
+        // hold block with it. Drop the change without sending T<n>.
+        else if (!planner.hold_queued()) {
+          tc_state = TC_IDLE;
+          set_runout_valid(true);
+        }
+        break;
+
+      case TC_HEATING:
+        // Nozzle heater restored after a timeout
+        if (ABS(thermalManager.degHotend(active_extruder) - thermalManager.degTargetHotend(active_extruder)) < TEMP_HYSTERESIS) {
+          LCD_MESSAGEPGM(MSG_MMU2_RESUMING);
+          BUZZ(200, 404);
+          BUZZ(200, 404);
+          tool_change_loaded();
+        }
+        break;
+    }
+  }
 
-    manage_response(true, true);
+  /**
+   * The MMU finished the T command. Have it continue loading while the held
+   * moves pull in the filament.
+   */
+  void MMU2::tool_change_loaded() {
+    if (mmu_print_saved) {
+      mmu_print_saved = false;
+      SERIAL_ECHOLNPGM("MMU starts responding\n");
+      if (tc_resume_temp) {
+        thermalManager.setTargetHotend(tc_resume_temp, active_extruder);
+        LCD_MESSAGEPGM(MSG_HEATING);
+        BUZZ(200, 40);
+        tc_state = TC_HEATING;
+        return;
+      }
+    }
 
-    command(MMU_CMD_C0);
-    extruder = index; //filament change is finished
+    cmd = MMU_CMD_C0;
+    ready = false;
+    extruder = tc_tool; //filament change is finished
     active_extruder = 0;
+    tc_state = TC_IDLE;
 
     enable_E0();
+    planner.release_hold();
 
     SERIAL_ECHO_START();
     SERIAL_ECHOLNPAIR(MSG_ACTIVE_EXTRUDER, int(extruder));
 
     ui.reset_status();
+    set_runout_valid(true);
   }
 
-  set_runout_valid(true);
-}
+  /**
+   * The T command timed out and is about to be sent again. The nozzle
+   * can't be parked with moves waiting in the planner, so just turn off
+   * the heater until the MMU responds.
+   */
+  void MMU2::tool_change_timeout() {
+    if (mmu_print_saved) return;
+    mmu_print_saved = true;
+
+    SERIAL_ECHOLNPGM("MMU not responding");
+
+    tc_resume_temp = thermalManager.degTargetHotend(active_extruder);
+    thermalManager.setTargetHotend(0, active_extruder);
+
+    LCD_MESSAGEPGM(MSG_MMU2_NOT_RESPONDING);
+    BUZZ(100, 659);
+    BUZZ(200, 698);
+    BUZZ(100, 659);
+    BUZZ(300, 440);
+    BUZZ(100, 659);
+  }
+
+#endif // MMU2_PIPELINED_TOOLCHANGE
 
 /**
  *
@@ -524,6 +657,9 @@ void MMU2::tool_change(const char* special) {
  */
 void MMU2::command(const uint8_t mmu_cmd) {
   if (!enabled) return;
+  #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+    while (tc_state != TC_IDLE) idle(); // Finish a queued tool change first
+  #endif
   cmd = mmu_cmd;
   ready = false;
 }
@@ -773,9 +909,17 @@ void MMU2::filament_runout() {
     execute_extruder_sequence((const E_Step *)ramming_sequence, sizeof(ramming_sequence) / sizeof(E_Step));
   }
 
+  /**
+   * With MMU2_PIPELINED_TOOLCHANGE queue the whole sequence so it runs straight
+   * on from any moves still in the planner and its steps blend together.
+   * Otherwise run each step on its own. Wait for the end before turning off
+   * the extruder.
+   */
   void MMU2::execute_extruder_sequence(const E_Step * sequence, int steps) {
 
-    planner.synchronize();
+    #if DISABLED(MMU2_PIPELINED_TOOLCHANGE)
+      planner.synchronize();
+    #endif
     enable_E0();
 
     const E_Step* step = sequence;
@@ -789,11 +933,16 @@ void MMU2::filament_runout() {
 
       current_position[E_AXIS] += es;
       line_to_current_position(MMM_TO_MMS(fr_mm_m));
-      planner.synchronize();
+      #if DISABLED(MMU2_PIPELINED_TOOLCHANGE)
+        planner.synchronize();
+      #endif
 
       step++;
     }
 
+    #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+      planner.synchronize();
+    #endif
     disable_E0();
   }
 
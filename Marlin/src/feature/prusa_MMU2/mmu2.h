@@ -72,6 +72,16 @@ private:
 
   static void filament_runout();
 
+  #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+    enum ToolChangeState : uint8_t { TC_IDLE, TC_WAIT_MOVES, TC_LOADING, TC_HEATING };
+    static ToolChangeState tc_state;
+    static uint8_t tc_tool;
+    static int16_t tc_resume_temp;
+    static void tool_change_loop();
+    static void tool_change_loaded();
+    static void tool_change_timeout();
+  #endif
+
   static bool enabled, ready, mmu_print_saved;
   static uint8_t cmd, cmd_arg, last_cmd, extruder;
   static int8_t state;
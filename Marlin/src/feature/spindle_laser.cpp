@@ -61,26 +61,49 @@ void SpindleLaser::init() {
 
 #endif
 
-void SpindleLaser::update_output() {
-  const bool ena = enabled();
+#if ENABLED(LASER_POWER_INLINE)
+  bool SpindleLaser::inline_enabled; // = false
+  uint8_t SpindleLaser::inline_ocr;  // = 0
+#endif
+
+#if ENABLED(SPINDLE_LASER_PWM)
+
+  uint8_t SpindleLaser::power_to_ocr(const cutter_power_t pwr) {
+    constexpr float inv_slope = RECIPROCAL(SPEED_POWER_SLOPE),
+                    min_ocr = (SPEED_POWER_MIN - (SPEED_POWER_INTERCEPT)) * inv_slope,  // Minimum allowed
+                    max_ocr = (SPEED_POWER_MAX - (SPEED_POWER_INTERCEPT)) * inv_slope;  // Maximum allowed
+    int16_t ocr_val;
+         if (pwr <= SPEED_POWER_MIN) ocr_val = min_ocr;                                 // Use minimum if set below
+    else if (pwr >= SPEED_POWER_MAX) ocr_val = max_ocr;                                 // Use maximum if set above
+    else ocr_val = (pwr - (SPEED_POWER_INTERCEPT)) * inv_slope;                         // Use calculated OCR value
+    return ocr_val & 0xFF;                                                              // ...limited to Atmel PWM max
+  }
+
+#endif
+
+void SpindleLaser::apply_output(const bool ena, const uint8_t ocr) {
   #if ENABLED(SPINDLE_LASER_PWM)
-    if (ena) {
-      constexpr float inv_slope = RECIPROCAL(SPEED_POWER_SLOPE),
-                      min_ocr = (SPEED_POWER_MIN - (SPEED_POWER_INTERCEPT)) * inv_slope,  // Minimum allowed
-                      max_ocr = (SPEED_POWER_MAX - (SPEED_POWER_INTERCEPT)) * inv_slope;  // Maximum allowed
-      int16_t ocr_val;
-           if (power <= SPEED_POWER_MIN) ocr_val = min_ocr;                               // Use minimum if set below
-      else if (power >= SPEED_POWER_MAX) ocr_val = max_ocr;                               // Use maximum if set above
-      else ocr_val = (power - (SPEED_POWER_INTERCEPT)) * inv_slope;                       // Use calculated OCR value
-      set_ocr(ocr_val & 0xFF);                                                            // ...limited to Atmel PWM max
-    }
-    else {                                                                                // Convert RPM to PWM duty cycle
-      WRITE(SPINDLE_LASER_ENA_PIN, !SPINDLE_LASER_ACTIVE_HIGH);                           // Turn spindle off (active low)
-      analogWrite(pin_t(SPINDLE_LASER_PWM_PIN), SPINDLE_LASER_PWM_INVERT ? 255 : 0);      // Only write low byte
+    if (ena)
+      set_ocr(ocr);
+    else {                                                                              // Convert RPM to PWM duty cycle
+      WRITE(SPINDLE_LASER_ENA_PIN, !SPINDLE_LASER_ACTIVE_HIGH);                         // Turn spindle off (active low)
+      analogWrite(pin_t(SPINDLE_LASER_PWM_PIN), SPINDLE_LASER_PWM_INVERT ? 255 : 0);    // Only write low byte
     }
   #else
+    UNUSED(ocr);
     WRITE(SPINDLE_LASER_ENA_PIN, ena ? SPINDLE_LASER_ACTIVE_HIGH : !SPINDLE_LASER_ACTIVE_HIGH);
   #endif
+}
+
+void SpindleLaser::update_output() {
+  const bool ena = enabled();
+  apply_output(ena,
+    #if ENABLED(SPINDLE_LASER_PWM)
+      ena ? power_to_ocr(power) : 0
+    #else
+      0
+    #endif
+  );
   power_delay(ena);
 }
 
@@ -59,9 +59,33 @@ public:
 
   static void update_output();
 
+  // Drive the outputs directly, without waiting for power-up / power-down
+  static void apply_output(const bool ena, const uint8_t ocr);
+
   #if ENABLED(SPINDLE_LASER_PWM)
     static void set_ocr(const uint8_t ocr);
     static inline void set_ocr_power(const uint8_t pwr) { power = pwr; set_ocr(pwr); }
+    static uint8_t power_to_ocr(const cutter_power_t pwr);
+  #endif
+
+  #if ENABLED(LASER_POWER_INLINE)
+    // Power for moves entering the planner. The stepper applies it as each move starts.
+    static bool inline_enabled;
+    static uint8_t inline_ocr;
+
+    static inline void set_inline_power(const cutter_power_t pwr) {
+      power = pwr;
+      inline_enabled = !!pwr;
+      #if ENABLED(SPINDLE_LASER_PWM)
+        if (pwr) inline_ocr = power_to_ocr(pwr);
+      #endif
+    }
+
+    #if ENABLED(SPINDLE_LASER_PWM)
+      static inline void set_inline_ocr(const uint8_t ocr) { power = ocr; inline_enabled = ocr > 0; inline_ocr = ocr; }
+    #endif
+
+    static inline void apply_inline() { apply_output(inline_enabled, inline_ocr); }
   #endif
 
   // Wait for spindle to spin up or spin down
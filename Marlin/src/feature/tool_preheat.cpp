@@ -0,0 +1,319 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/tool_preheat.cpp - Lookahead tool preheating
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TOOLCHANGE_PREHEAT)
+
+#include "tool_preheat.h"
+
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../module/printcounter.h"
+#include "../gcode/gcode.h"
+#include "../gcode/queue.h"
+#include "../sd/cardreader.h"
+
+#define PREHEAT_RESCAN_MS    5000UL // Time between scans
+
+ToolPreheat tool_preheat;
+
+int16_t ToolPreheat::print_temp[HOTENDS]; // = { 0 }
+uint8_t ToolPreheat::standby;             // = 0
+
+bool ToolPreheat::scanning,               // = false
+     ToolPreheat::scan_done,
+     ToolPreheat::busy;
+millis_t ToolPreheat::next_scan_ms,       // = 0
+         ToolPreheat::origin_ms;
+float ToolPreheat::scan_secs,
+      ToolPreheat::planned_secs,
+      ToolPreheat::use_secs[HOTENDS],
+      ToolPreheat::scan_pos[XYZE],
+      ToolPreheat::scan_fr_mm_s;
+uint8_t ToolPreheat::scan_relative,
+        ToolPreheat::scan_found,
+        ToolPreheat::busy_tools;
+
+#if ENABLED(SDSUPPORT)
+  bool ToolPreheat::scan_eof,
+       ToolPreheat::scan_comment;
+  uint32_t ToolPreheat::scan_sdend;
+  char ToolPreheat::scan_line[MAX_CMD_SIZE];
+  uint8_t ToolPreheat::scan_line_len;
+
+  static SdFile scan_file;                // Reads ahead without moving the print position
+  static uint8_t scan_block[512];         // SD bytes to scan per call to update()
+#endif
+
+static inline bool printing() { return IS_SD_PRINTING() || print_job_timer.isRunning(); }
+
+/**
+ * Track the temperature each tool prints at. Slicers often lower idle
+ * tools themselves with "M104 Tn", so only M109 and M104 for the active
+ * tool are taken as the print temperature. Any explicit temperature
+ * cancels standby for that tool.
+ */
+void ToolPreheat::set_print_temp(const uint8_t e, const int16_t celsius, const bool is_wait) {
+  if (e >= HOTENDS) return;
+  CBI(standby, e);
+  if (celsius > (EXTRUDE_MINTEMP) / 2 && (is_wait || e == active_extruder))
+    print_temp[e] = celsius;
+}
+
+/**
+ * Before a tool change make sure the new tool is up to temperature.
+ * Only applies if the tool was still in standby, i.e., its use wasn't
+ * seen in time, and only waits if it isn't already within TEMP_HYSTERESIS.
+ * Then rescan for the tool after this one.
+ */
+void ToolPreheat::tool_change(const uint8_t new_tool) {
+  if (new_tool < HOTENDS && TEST(standby, new_tool)) {
+    CBI(standby, new_tool);
+    thermalManager.setTargetHotend(print_temp[new_tool], new_tool);
+    if (thermalManager.still_heating(new_tool)) {
+      busy = true;
+      (void)thermalManager.wait_for_hotend(new_tool);
+      busy = false;
+    }
+  }
+  scanning = false;
+  next_scan_ms = millis();
+}
+
+void ToolPreheat::update() {
+  if (busy || !printing()) { scanning = false; return; }
+
+  const millis_t ms = millis();
+  if (!scanning) {
+    if (PENDING(ms, next_scan_ms)) return;
+    start_scan(ms);
+  }
+
+  #if ENABLED(SDSUPPORT)
+    if (!scan_done) scan_sd_chunk();
+  #endif
+
+  if (scan_done) {
+    scanning = false;
+    apply(ms);
+    next_scan_ms = ms + PREHEAT_RESCAN_MS;
+  }
+}
+
+/**
+ * Start a new scan. The blocks still in the planner are timed at their
+ * nominal rates, then the commands waiting in the queue are read, and the
+ * SD file is read by update(). Tools with moves still in the planner are
+ * kept hot, since a T command runs as soon as the queue reaches it.
+ */
+void ToolPreheat::start_scan(const millis_t ms) {
+  origin_ms = ms;
+  scan_secs = 0;
+  busy_tools = _BV(active_extruder);
+  for (uint8_t b = planner.block_buffer_tail; b != planner.block_buffer_head; b = BLOCK_MOD(b + 1)) {
+    const block_t * const block = &planner.block_buffer[b];
+    if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION)) continue;
+    if (block->nominal_rate) scan_secs += float(block->step_event_count) / block->nominal_rate;
+    SBI(busy_tools, block->extruder);
+  }
+  planned_secs = scan_secs;
+
+  scan_found = 0;
+  scan_done = false;
+  COPY(scan_pos, current_position);
+  scan_fr_mm_s = feedrate_mm_s;
+  scan_relative = gcode.axis_relative;
+
+  for (uint8_t i = 0, r = queue.index_r; i < queue.length; i++) {
+    parse_line(queue.command_buffer[r]);
+    if (++r >= BUFSIZE) r = 0;
+  }
+
+  #if ENABLED(SDSUPPORT)
+    scan_eof = false;
+    if (IS_SD_PRINTING() && !scan_done) {
+      scan_file = card.getFile();
+      scan_sdend = scan_file.curPosition() + (TOOLCHANGE_PREHEAT_SCAN_BYTES);
+      scan_line_len = 0;
+      scan_comment = false;
+    }
+    else
+  #endif
+      scan_done = true;
+
+  scanning = true;
+}
+
+#if ENABLED(SDSUPPORT)
+
+  /**
+   * Read the SD file ahead of the print, up to one block per call, with
+   * a copy of the print's file handle so the print position is untouched.
+   * Whole blocks are read straight into scan_block, bypassing the volume
+   * cache that holds the block being printed. Comments are dropped as
+   * they're read.
+   */
+  void ToolPreheat::scan_sd_chunk() {
+    const uint32_t sdpos = scan_file.curPosition();
+    if (sdpos >= scan_sdend) { scan_done = true; return; }
+    const int16_t len = scan_file.read(scan_block, sizeof(scan_block) - (sdpos & (sizeof(scan_block) - 1)));
+    if (len <= 0) { scan_done = true; scan_eof = !len; return; }
+    for (int16_t n = 0; n < len; n++) {
+      const char c = scan_block[n];
+      if (c == '\n' || c == '\r') {
+        if (scan_line_len) {
+          scan_line[scan_line_len] = '\0';
+          parse_line(scan_line);
+        }
+        scan_line_len = 0;
+        scan_comment = false;
+        if (scan_done) break;
+      }
+      else if (c == ';')
+        scan_comment = true;
+      else if (!scan_comment && scan_line_len < MAX_CMD_SIZE - 1)
+        scan_line[scan_line_len++] = c;
+    }
+  }
+
+#endif // SDSUPPORT
+
+// Get the value following a parameter letter, if present
+static bool scan_value(const char * const args, const char code, float &value) {
+  const char * const p = strchr(args, code);
+  if (!p) return false;
+  value = strtod(p + 1, nullptr);
+  return true;
+}
+
+/**
+ * Update the estimated time and position with one command. Only moves
+ * and dwells add time, timed at their feedrate with no acceleration, so
+ * the estimate errs on the early side.
+ */
+void ToolPreheat::parse_line(const char *cmd) {
+  while (*cmd == ' ') cmd++;
+  if (*cmd == 'N') {                      // Skip the line number
+    do cmd++; while (NUMERIC(*cmd));
+    while (*cmd == ' ') cmd++;
+  }
+
+  const char letter = *cmd++;
+  if (!NUMERIC(*cmd)) return;
+  const int code = atoi(cmd);
+  while (NUMERIC(*cmd)) cmd++;
+
+  float v;
+  switch (letter) {
+    case 'G':
+      switch (code) {
+        case 0: case 1: case 2: case 3: {
+          if (scan_value(cmd, 'F', v) && v > 0) scan_fr_mm_s = MMM_TO_MMS(v);
+          float dist_sqr = 0, de = 0;
+          LOOP_XYZE(i) {
+            if (!scan_value(cmd, axis_codes[i], v)) continue;
+            const bool rel = i == E_AXIS && (scan_relative & (_BV(E_MODE_ABS) | _BV(E_MODE_REL)))
+              ? TEST(scan_relative, E_MODE_REL)
+              : TEST(scan_relative, i);
+            const float d = rel ? v : v - scan_pos[i];
+            scan_pos[i] += d;
+            if (i == E_AXIS) de = d; else dist_sqr += sq(d);
+          }
+          const float dist = dist_sqr ? SQRT(dist_sqr) : ABS(de);
+          if (scan_fr_mm_s > 0 && feedrate_percentage > 0) scan_secs += dist / MMS_SCALED(scan_fr_mm_s);
+        } break;
+        case 4:
+          if (scan_value(cmd, 'P', v)) scan_secs += v * 0.001f;
+          else if (scan_value(cmd, 'S', v)) scan_secs += v;
+          break;
+        case 90: scan_relative = 0; break;
+        case 91: scan_relative = _BV(REL_X) | _BV(REL_Y) | _BV(REL_Z) | _BV(REL_E); break;
+        case 92: LOOP_XYZE(i) if (scan_value(cmd, axis_codes[i], v)) scan_pos[i] = v; break;
+      }
+      break;
+
+    case 'M':
+      if (code == 82) { CBI(scan_relative, E_MODE_REL); SBI(scan_relative, E_MODE_ABS); }
+      else if (code == 83) { CBI(scan_relative, E_MODE_ABS); SBI(scan_relative, E_MODE_REL); }
+      break;
+
+    case 'T':
+      if (code < HOTENDS && !TEST(scan_found, code)) {
+        SBI(scan_found, code);
+        use_secs[code] = scan_secs;
+      }
+      break;
+  }
+
+  // Stop when every other tool is found, or anything further is standby anyway
+  if ((scan_found | busy_tools) == _BV(HOTENDS) - 1 || scan_secs > (TOOLCHANGE_PREHEAT_STANDBY_TIME))
+    scan_done = true;
+}
+
+void ToolPreheat::set_standby(const uint8_t e, const bool stby) {
+  if (stby) {
+    if (TEST(standby, e) || thermalManager.degTargetHotend(e) <= (TOOLCHANGE_PREHEAT_STANDBY_TEMP)) return;
+    SBI(standby, e);
+    thermalManager.setTargetHotend(TOOLCHANGE_PREHEAT_STANDBY_TEMP, e);
+  }
+  else if (thermalManager.degTargetHotend(e) < print_temp[e]) {
+    CBI(standby, e);
+    thermalManager.setTargetHotend(print_temp[e], e);
+  }
+}
+
+/**
+ * Heat each idle tool so it reaches its print temperature (plus a margin)
+ * by its next use. The T command is reached about one planner buffer ahead
+ * of its moves, and the tool must be hot by then to plan its extrusion.
+ * Drop a tool to standby if its next use is more than
+ * TOOLCHANGE_PREHEAT_STANDBY_TIME away, or it isn't used again.
+ */
+void ToolPreheat::apply(const millis_t ms) {
+  const millis_t standby_ms = ms + 1000UL * (TOOLCHANGE_PREHEAT_STANDBY_TIME);
+  HOTEND_LOOP() {
+    if (TEST(busy_tools, e) || !print_temp[e]) continue;
+    if (TEST(scan_found, e)) {
+      const millis_t use_ms = origin_ms + millis_t(_MAX(use_secs[e] - planned_secs, 0) * 1000);
+      const float rise = _MAX(print_temp[e] - thermalManager.degHotend(e), 0);
+      const millis_t heat_ms = millis_t((rise / (TOOLCHANGE_PREHEAT_RATE) + (TOOLCHANGE_PREHEAT_MARGIN)) * 1000);
+      if (ELAPSED(ms + heat_ms, use_ms))
+        set_standby(e, false);
+      else if (ELAPSED(use_ms, standby_ms))
+        set_standby(e, true);
+    }
+    else if (scan_secs > (TOOLCHANGE_PREHEAT_STANDBY_TIME)
+      #if ENABLED(SDSUPPORT)
+        || scan_eof
+      #endif
+    )
+      set_standby(e, true);
+  }
+}
+
+#endif // TOOLCHANGE_PREHEAT
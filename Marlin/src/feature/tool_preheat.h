@@ -0,0 +1,80 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/tool_preheat.h - Lookahead tool preheating
+ *
+ * While a print runs, the planner, the command queue and the SD file
+ * ahead of the read position are scanned for the next use of each tool.
+ * The time until then is estimated from the block and move durations,
+ * and idle tools are heated just in time or dropped to standby.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class ToolPreheat {
+  public:
+    // Remember the temperature a tool prints at (M104 / M109)
+    static void set_print_temp(const uint8_t e, const int16_t celsius, const bool is_wait);
+
+    // Called from idle() to advance the scanner and adjust idle tools
+    static void update();
+
+    // Called before a tool change. Heats and waits if the prediction was missed.
+    static void tool_change(const uint8_t new_tool);
+
+  private:
+    static int16_t print_temp[HOTENDS];   // Temperature each tool prints at
+    static uint8_t standby;               // Tools currently lowered to standby
+
+    // Scanner state
+    static bool scanning,
+                busy;                     // Waiting in tool_change()
+    static millis_t next_scan_ms,         // Time to start the next scan
+                    origin_ms;            // Time the current scan started
+    static float scan_secs,               // Estimated duration of the planned and scanned commands
+                 planned_secs,            // Estimated duration of the planned moves
+                 use_secs[HOTENDS],       // Estimated time of each tool's next use, from origin_ms
+                 scan_pos[XYZE],          // Position at the end of the scanned commands
+                 scan_fr_mm_s;            // Feedrate at the end of the scanned commands
+    static uint8_t scan_relative,         // Relative modes, as in GcodeSuite::axis_relative
+                   scan_found,            // Tools whose next use has been found
+                   busy_tools;            // The active tool and tools with planned moves
+    static bool scan_done;                // The scan is complete
+
+    #if ENABLED(SDSUPPORT)
+      static bool scan_eof;               // The scan reached the end of the file
+      static uint32_t scan_sdend;
+      static char scan_line[MAX_CMD_SIZE];
+      static uint8_t scan_line_len;
+      static bool scan_comment;
+      static void scan_sd_chunk();
+    #endif
+
+    static void start_scan(const millis_t ms);
+    static void parse_line(const char *cmd);
+    static void apply(const millis_t ms);
+    static void set_standby(const uint8_t e, const bool stby);
+};
+
+extern ToolPreheat tool_preheat;
@@ -185,16 +185,40 @@ static float std_dev_points(float z_pt[NPP + 1], const bool _0p_cal, const bool
   return 0.00001f;
 }
 
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
+  #define LSQ_MAX_POINTS 100                    // P10 probes 100 points
+
+  static float lsq_carriage[LSQ_MAX_POINTS][ABC]; // Carriage positions at each probed point
+  static uint8_t lsq_points;
+
+  /**
+   *  - Record the carriage positions where a point was probed
+   */
+  static void lsq_record_point(const float &nx, const float &ny, const float &nz) {
+    if (lsq_points >= LSQ_MAX_POINTS) return;
+    const float pos[XYZ] = { nx, ny, nz };
+    inverse_kinematics(pos);
+    LOOP_XYZ(axis) lsq_carriage[lsq_points][axis] = delta[axis];
+    lsq_points++;
+  }
+
+#endif
+
 /**
  *  - Probe a point
  */
 static float calibration_probe(const float &nx, const float &ny, const bool stow) {
   #if HAS_BED_PROBE
-    return probe_at_point(nx, ny, stow ? PROBE_PT_STOW : PROBE_PT_RAISE, 0, false);
+    const float z = probe_at_point(nx, ny, stow ? PROBE_PT_STOW : PROBE_PT_RAISE, 0, false);
   #else
     UNUSED(stow);
-    return lcd_probe_pt(nx, ny);
+    const float z = lcd_probe_pt(nx, ny);
   #endif
+  #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+    if (!isnan(z)) lsq_record_point(nx, ny, z);
+  #endif
+  return z;
 }
 
 /**
@@ -275,6 +299,8 @@ static bool probe_calibration_points(float z_pt[NPP + 1], const int8_t probe_poi
   return true;
 }
 
+#if DISABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
 /**
  * kinematics routines and auto tune matrix scaling parameters:
  * see https://github.com/LVD-AC/Marlin-AC/tree/1.1.x-AC/documentation for
@@ -381,6 +407,160 @@ static float auto_tune_a() {
   return a_fac;
 }
 
+#endif // !DELTA_CALIBRATION_LEAST_SQUARES
+
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
+  /**
+   * Least-squares calibration
+   *
+   * The carriages were physically at the recorded positions when the probe
+   * touched the bed. For a set of trial settings, shift those positions by
+   * the change in where the carriages home, then the forward kinematics give
+   * the Z each point would have. The settings are solved by Gauss-Newton to
+   * bring all points to Z=0, with the Jacobian found by finite differences.
+   */
+  enum LsqParam : uint8_t { LSQ_E_A, LSQ_E_B, LSQ_E_C, LSQ_RADIUS, LSQ_T_A, LSQ_T_B, LSQ_ROD, LSQ_PARAMS };
+
+  #define LSQ_DIFF          0.05f               // (mm/°) Step for the finite differences
+  #define LSQ_ITERATIONS    4                   // Gauss-Newton iterations (no extra probing)
+
+  typedef struct {
+    float tower[ABC][2],                        // Tower positions (delta_tower)
+          rod2[ABC],                            // Squared rod lengths (delta_diagonal_rod_2_tower)
+          shift[ABC];                           // Shift of the recorded carriage positions
+  } lsq_geometry_t;
+
+  static float& lsq_param(const uint8_t p) {
+    switch (p) {
+      default:         return delta_endstop_adj[p];
+      case LSQ_RADIUS: return delta_radius;
+      case LSQ_T_A:    return delta_tower_angle_trim[A_AXIS];
+      case LSQ_T_B:    return delta_tower_angle_trim[B_AXIS];
+      case LSQ_ROD:    return delta_diagonal_rod;
+    }
+  }
+
+  // Carriage positions with the effector homed at the center
+  static void lsq_home_carriages(float home[ABC]) {
+    LOOP_XYZ(axis) home[axis] = delta_height + SQRT(delta_diagonal_rod_2_tower[axis] - HYPOT2(delta_tower[axis][X_AXIS], delta_tower[axis][Y_AXIS]));
+  }
+
+  // Capture the geometry of the current settings, relative to the probing settings
+  static void lsq_get_geometry(lsq_geometry_t &g, const float adj0[ABC], const float home0[ABC]) {
+    recalc_delta_settings();
+    float home[ABC];
+    lsq_home_carriages(home);
+    COPY(g.tower, delta_tower);
+    COPY(g.rod2, delta_diagonal_rod_2_tower);
+    LOOP_XYZ(axis) g.shift[axis] = adj0[axis] - delta_endstop_adj[axis] + home[axis] - home0[axis];
+  }
+
+  // Z of a recorded point with the given geometry
+  static float lsq_z(const lsq_geometry_t &g, const float (&carriage)[ABC]) {
+    COPY(delta_tower, g.tower);
+    COPY(delta_diagonal_rod_2_tower, g.rod2);
+    forward_kinematics_DELTA(carriage[A_AXIS] + g.shift[A_AXIS], carriage[B_AXIS] + g.shift[B_AXIS], carriage[C_AXIS] + g.shift[C_AXIS]);
+    return cartes[Z_AXIS];
+  }
+
+  // Solve A.x = b by Gaussian elimination with partial pivoting. A and b are destroyed.
+  static bool lsq_solve_linear(float A[LSQ_PARAMS][LSQ_PARAMS], float b[LSQ_PARAMS], float x[LSQ_PARAMS], const uint8_t n) {
+    for (uint8_t c = 0; c < n; c++) {
+      uint8_t piv = c;
+      for (uint8_t r = c + 1; r < n; r++) if (ABS(A[r][c]) > ABS(A[piv][c])) piv = r;
+      if (ABS(A[piv][c]) < 1e-12f) return false;
+      if (piv != c) {
+        for (uint8_t k = c; k < n; k++) { const float t = A[c][k]; A[c][k] = A[piv][k]; A[piv][k] = t; }
+        const float t = b[c]; b[c] = b[piv]; b[piv] = t;
+      }
+      for (uint8_t r = c + 1; r < n; r++) {
+        const float f = A[r][c] / A[c][c];
+        for (uint8_t k = c; k < n; k++) A[r][k] -= f * A[c][k];
+        b[r] -= f * b[c];
+      }
+    }
+    for (int8_t r = n - 1; r >= 0; r--) {
+      float sum = b[r];
+      for (uint8_t k = r + 1; k < n; k++) sum -= A[r][k] * x[k];
+      x[r] = sum / A[r][r];
+    }
+    return true;
+  }
+
+  /**
+   * Solve the settings selected by param_bits from the recorded points.
+   * Leaves the new settings in place and returns the expected std dev of
+   * the points, or NAN (with the old settings restored) if it fails.
+   */
+  static float lsq_calibrate(const uint8_t param_bits) {
+    uint8_t param[LSQ_PARAMS], n = 0;
+    for (uint8_t p = 0; p < LSQ_PARAMS; p++) if (TEST(param_bits, p)) param[n++] = p;
+    if (!n || !lsq_points) return NAN;
+
+    float adj0[ABC], home0[ABC], old_value[LSQ_PARAMS];
+    COPY(adj0, delta_endstop_adj);
+    lsq_home_carriages(home0);
+    for (uint8_t j = 0; j < n; j++) old_value[j] = lsq_param(param[j]);
+
+    lsq_geometry_t g0, g[LSQ_PARAMS];
+    float sum_sq = 0;
+    for (uint8_t iter = 0; iter <= LSQ_ITERATIONS; iter++) {
+
+      // Geometry at the current estimate, and with each parameter nudged
+      lsq_get_geometry(g0, adj0, home0);
+      for (uint8_t j = 0; j < n; j++) {
+        float &v = lsq_param(param[j]);
+        v += LSQ_DIFF;
+        lsq_get_geometry(g[j], adj0, home0);
+        v -= LSQ_DIFF;
+      }
+
+      // Build the normal equations
+      float A[LSQ_PARAMS][LSQ_PARAMS] = { { 0 } }, b[LSQ_PARAMS] = { 0 }, x[LSQ_PARAMS];
+      sum_sq = 0;
+      for (uint8_t i = 0; i < lsq_points; i++) {
+        const float z = lsq_z(g0, lsq_carriage[i]);
+        float J[LSQ_PARAMS];
+        for (uint8_t j = 0; j < n; j++) J[j] = (lsq_z(g[j], lsq_carriage[i]) - z) * (1.0f / LSQ_DIFF);
+        for (uint8_t j = 0; j < n; j++) {
+          for (uint8_t k = 0; k <= j; k++) A[j][k] += J[j] * J[k];
+          b[j] -= J[j] * z;
+        }
+        sum_sq += sq(z);
+      }
+
+      if (iter == LSQ_ITERATIONS) break;        // Only the residuals were wanted
+
+      // Mirror the triangle and add a little damping, for settings the points can't tell apart
+      float trace = 0;
+      for (uint8_t j = 0; j < n; j++) trace += A[j][j];
+      for (uint8_t j = 0; j < n; j++) {
+        for (uint8_t k = j + 1; k < n; k++) A[j][k] = A[k][j];
+        A[j][j] += 1e-5f * trace / n + 1e-9f;
+      }
+
+      bool ok = lsq_solve_linear(A, b, x, n);
+      float step = 0;
+      for (uint8_t j = 0; ok && j < n; j++) {
+        if (isnan(x[j])) ok = false;
+        NOLESS(step, ABS(x[j]));
+      }
+      if (!ok) {
+        for (uint8_t j = 0; j < n; j++) lsq_param(param[j]) = old_value[j];
+        recalc_delta_settings();
+        return NAN;
+      }
+      for (uint8_t j = 0; j < n; j++) lsq_param(param[j]) += x[j];
+      if (step < 0.001f) iter = LSQ_ITERATIONS - 1; // Converged. Get the final residuals.
+    }
+
+    recalc_delta_settings();
+    return SQRT(sum_sq / lsq_points);
+  }
+
+#endif // DELTA_CALIBRATION_LEAST_SQUARES
+
 /**
  * G33 - Delta '1-4-7-point' Auto-Calibration
  *       Calibrate height, z_offset, endstops, delta radius, and tower angles.
@@ -407,6 +587,11 @@ static float auto_tune_a() {
  *      V3  Report settings and probe results
  *
  *   E   Engage the probe for each point
+ *
+ *   L   Also calibrate the diagonal rod length (P5 or more, with DELTA_CALIBRATION_LEAST_SQUARES)
+ *
+ * With DELTA_CALIBRATION_LEAST_SQUARES all settings are solved from a single
+ * round of probing, so G33 only iterates when forced with F.
  */
 void GcodeSuite::G33() {
 
@@ -438,6 +623,15 @@ void GcodeSuite::G33() {
 
   const bool stow_after_each = parser.seen('E');
 
+  #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+    const bool rod_set = parser.seen('L');
+    if (rod_set && probe_points < 5) {
+      SERIAL_ECHOLNPGM("?(L) requires (P)oints 5 or more.");
+      return;
+    }
+    float lsq_std_dev = 0.0f;
+  #endif
+
   const bool _0p_calibration      = probe_points == 0,
              _1p_calibration      = probe_points == 1 || probe_points == -1,
              _4p_calibration      = probe_points == 2,
@@ -453,9 +647,6 @@ void GcodeSuite::G33() {
         zero_std_dev = (verbose_level ? 999.0f : 0.0f), // 0.0 in dry-run mode : forced end
         zero_std_dev_min = zero_std_dev,
         zero_std_dev_old = zero_std_dev,
-        h_factor,
-        r_factor,
-        a_factor,
         e_old[ABC] = {
           delta_endstop_adj[A_AXIS],
           delta_endstop_adj[B_AXIS],
@@ -504,6 +695,9 @@ void GcodeSuite::G33() {
 
     // Probe the points
     zero_std_dev_old = zero_std_dev;
+    #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+      lsq_points = 0;
+    #endif
     if (!probe_calibration_points(z_at_pt, probe_points, towers_set, stow_after_each)) {
       SERIAL_ECHOLNPGM("Correct delta settings with M665 and M666");
       return AC_CLEANUP();
@@ -526,72 +720,96 @@ void GcodeSuite::G33() {
         COPY(a_old, delta_tower_angle_trim);
       }
 
-      float e_delta[ABC] = { 0.0f },
-            r_delta = 0.0f,
-            t_delta[ABC] = { 0.0f };
-
-      /**
-       * convergence matrices:
-       * see https://github.com/LVD-AC/Marlin-AC/tree/1.1.x-AC/documentation for
-       *  - definition of the matrix scaling parameters
-       *  - matrices for 4 and 7 point calibration
-       */
-      #define ZP(N,I) ((N) * z_at_pt[I] / 4.0f) // 4.0 = divider to normalize to integers
-      #define Z12(I) ZP(12, I)
-      #define Z4(I) ZP(4, I)
-      #define Z2(I) ZP(2, I)
-      #define Z1(I) ZP(1, I)
-      #define Z0(I) ZP(0, I)
-
-      // calculate factors
-      const float cr_old = delta_calibration_radius;
-      if (_7p_9_center) delta_calibration_radius *= 0.9f;
-      h_factor = auto_tune_h();
-      r_factor = auto_tune_r();
-      a_factor = auto_tune_a();
-      delta_calibration_radius = cr_old;
-
-      switch (probe_points) {
-        case 0:
-          test_precision = 0.0f; // forced end
-          break;
+      #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
+        UNUSED(_7p_9_center);
 
-        case 1:
+        if (_0p_calibration)
           test_precision = 0.0f; // forced end
-          LOOP_XYZ(axis) e_delta[axis] = +Z4(CEN);
-          break;
-
-        case 2:
-          if (towers_set) { // see 4 point calibration (towers) matrix
-            e_delta[A_AXIS] = (+Z4(__A) -Z2(__B) -Z2(__C)) * h_factor  +Z4(CEN);
-            e_delta[B_AXIS] = (-Z2(__A) +Z4(__B) -Z2(__C)) * h_factor  +Z4(CEN);
-            e_delta[C_AXIS] = (-Z2(__A) -Z2(__B) +Z4(__C)) * h_factor  +Z4(CEN);
-            r_delta         = (+Z4(__A) +Z4(__B) +Z4(__C) -Z12(CEN)) * r_factor;
+        else {
+          const uint8_t params = _BV(LSQ_E_A) | _BV(LSQ_E_B) | _BV(LSQ_E_C)
+                               | (_1p_calibration ? 0 : _BV(LSQ_RADIUS))
+                               | (_angle_results ? _BV(LSQ_T_A) | _BV(LSQ_T_B) : 0)
+                               | (rod_set ? _BV(LSQ_ROD) : 0);
+          lsq_std_dev = lsq_calibrate(params);
+          if (isnan(lsq_std_dev)) {
+            SERIAL_ECHOLNPGM("Least-squares solution failed");
+            test_precision = 0.0f;
           }
-          else { // see 4 point calibration (opposites) matrix
-            e_delta[A_AXIS] = (-Z4(_BC) +Z2(_CA) +Z2(_AB)) * h_factor  +Z4(CEN);
-            e_delta[B_AXIS] = (+Z2(_BC) -Z4(_CA) +Z2(_AB)) * h_factor  +Z4(CEN);
-            e_delta[C_AXIS] = (+Z2(_BC) +Z2(_CA) -Z4(_AB)) * h_factor  +Z4(CEN);
-            r_delta         = (+Z4(_BC) +Z4(_CA) +Z4(_AB) -Z12(CEN)) * r_factor;
-          }
-          break;
-
-        default: // see 7 point calibration (towers & opposites) matrix
-          e_delta[A_AXIS] = (+Z2(__A) -Z1(__B) -Z1(__C) -Z2(_BC) +Z1(_CA) +Z1(_AB)) * h_factor  +Z4(CEN);
-          e_delta[B_AXIS] = (-Z1(__A) +Z2(__B) -Z1(__C) +Z1(_BC) -Z2(_CA) +Z1(_AB)) * h_factor  +Z4(CEN);
-          e_delta[C_AXIS] = (-Z1(__A) -Z1(__B) +Z2(__C) +Z1(_BC) +Z1(_CA) -Z2(_AB)) * h_factor  +Z4(CEN);
-          r_delta         = (+Z2(__A) +Z2(__B) +Z2(__C) +Z2(_BC) +Z2(_CA) +Z2(_AB) -Z12(CEN)) * r_factor;
-
-          if (towers_set) { // see 7 point tower angle calibration (towers & opposites) matrix
-            t_delta[A_AXIS] = (+Z0(__A) -Z4(__B) +Z4(__C) +Z0(_BC) -Z4(_CA) +Z4(_AB) +Z0(CEN)) * a_factor;
-            t_delta[B_AXIS] = (+Z4(__A) +Z0(__B) -Z4(__C) +Z4(_BC) +Z0(_CA) -Z4(_AB) +Z0(CEN)) * a_factor;
-            t_delta[C_AXIS] = (-Z4(__A) +Z4(__B) +Z0(__C) -Z4(_BC) +Z4(_CA) +Z0(_AB) +Z0(CEN)) * a_factor;
-          }
-          break;
-      }
-      LOOP_XYZ(axis) delta_endstop_adj[axis] += e_delta[axis];
-      delta_radius += r_delta;
-      LOOP_XYZ(axis) delta_tower_angle_trim[axis] += t_delta[axis];
+          else if (iterations > force_iterations)
+            test_precision = 0.0f; // One round of probing gives the whole solution
+        }
+
+      #else
+
+        float e_delta[ABC] = { 0.0f },
+              r_delta = 0.0f,
+              t_delta[ABC] = { 0.0f };
+
+        /**
+         * convergence matrices:
+         * see https://github.com/LVD-AC/Marlin-AC/tree/1.1.x-AC/documentation for
+         *  - definition of the matrix scaling parameters
+         *  - matrices for 4 and 7 point calibration
+         */
+        #define ZP(N,I) ((N) * z_at_pt[I] / 4.0f) // 4.0 = divider to normalize to integers
+        #define Z12(I) ZP(12, I)
+        #define Z4(I) ZP(4, I)
+        #define Z2(I) ZP(2, I)
+        #define Z1(I) ZP(1, I)
+        #define Z0(I) ZP(0, I)
+
+        // calculate factors
+        const float cr_old = delta_calibration_radius;
+        if (_7p_9_center) delta_calibration_radius *= 0.9f;
+        const float h_factor = auto_tune_h(),
+                    r_factor = auto_tune_r(),
+                    a_factor = auto_tune_a();
+        delta_calibration_radius = cr_old;
+
+        switch (probe_points) {
+          case 0:
+            test_precision = 0.0f; // forced end
+            break;
+
+          case 1:
+            test_precision = 0.0f; // forced end
+            LOOP_XYZ(axis) e_delta[axis] = +Z4(CEN);
+            break;
+
+          case 2:
+            if (towers_set) { // see 4 point calibration (towers) matrix
+              e_delta[A_AXIS] = (+Z4(__A) -Z2(__B) -Z2(__C)) * h_factor  +Z4(CEN);
+              e_delta[B_AXIS] = (-Z2(__A) +Z4(__B) -Z2(__C)) * h_factor  +Z4(CEN);
+              e_delta[C_AXIS] = (-Z2(__A) -Z2(__B) +Z4(__C)) * h_factor  +Z4(CEN);
+              r_delta         = (+Z4(__A) +Z4(__B) +Z4(__C) -Z12(CEN)) * r_factor;
+            }
+            else { // see 4 point calibration (opposites) matrix
+              e_delta[A_AXIS] = (-Z4(_BC) +Z2(_CA) +Z2(_AB)) * h_factor  +Z4(CEN);
+              e_delta[B_AXIS] = (+Z2(_BC) -Z4(_CA) +Z2(_AB)) * h_factor  +Z4(CEN);
+              e_delta[C_AXIS] = (+Z2(_BC) +Z2(_CA) -Z4(_AB)) * h_factor  +Z4(CEN);
+              r_delta         = (+Z4(_BC) +Z4(_CA) +Z4(_AB) -Z12(CEN)) * r_factor;
+            }
+            break;
+
+          default: // see 7 point calibration (towers & opposites) matrix
+            e_delta[A_AXIS] = (+Z2(__A) -Z1(__B) -Z1(__C) -Z2(_BC) +Z1(_CA) +Z1(_AB)) * h_factor  +Z4(CEN);
+            e_delta[B_AXIS] = (-Z1(__A) +Z2(__B) -Z1(__C) +Z1(_BC) -Z2(_CA) +Z1(_AB)) * h_factor  +Z4(CEN);
+            e_delta[C_AXIS] = (-Z1(__A) -Z1(__B) +Z2(__C) +Z1(_BC) +Z1(_CA) -Z2(_AB)) * h_factor  +Z4(CEN);
+            r_delta         = (+Z2(__A) +Z2(__B) +Z2(__C) +Z2(_BC) +Z2(_CA) +Z2(_AB) -Z12(CEN)) * r_factor;
+
+            if (towers_set) { // see 7 point tower angle calibration (towers & opposites) matrix
+              t_delta[A_AXIS] = (+Z0(__A) -Z4(__B) +Z4(__C) +Z0(_BC) -Z4(_CA) +Z4(_AB) +Z0(CEN)) * a_factor;
+              t_delta[B_AXIS] = (+Z4(__A) +Z0(__B) -Z4(__C) +Z4(_BC) +Z0(_CA) -Z4(_AB) +Z0(CEN)) * a_factor;
+              t_delta[C_AXIS] = (-Z4(__A) +Z4(__B) +Z0(__C) -Z4(_BC) +Z4(_CA) +Z0(_AB) +Z0(CEN)) * a_factor;
+            }
+            break;
+        }
+        LOOP_XYZ(axis) delta_endstop_adj[axis] += e_delta[axis];
+        delta_radius += r_delta;
+        LOOP_XYZ(axis) delta_tower_angle_trim[axis] += t_delta[axis];
+
+      #endif
     }
     else if (zero_std_dev >= test_precision) {
       // roll back
@@ -627,14 +845,19 @@ void GcodeSuite::G33() {
       if ((zero_std_dev >= test_precision && iterations > force_iterations) || zero_std_dev <= calibration_precision) { // end iterations
         SERIAL_ECHOPGM("Calibration OK");
         SERIAL_ECHO_SP(32);
-        #if HAS_BED_PROBE
-          if (zero_std_dev >= test_precision && !_1p_calibration && !_0p_calibration)
-            SERIAL_ECHOPGM("rolling back.");
-          else
+        #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+          SERIAL_ECHOPAIR_F("std dev:", zero_std_dev, 3);
+          if (!_0p_calibration) SERIAL_ECHOPAIR_F(" expected:", lsq_std_dev, 3);
+        #else
+          #if HAS_BED_PROBE
+            if (zero_std_dev >= test_precision && !_1p_calibration && !_0p_calibration)
+              SERIAL_ECHOPGM("rolling back.");
+            else
+          #endif
+            {
+              SERIAL_ECHOPAIR_F("std dev:", zero_std_dev_min, 3);
+            }
         #endif
-          {
-            SERIAL_ECHOPAIR_F("std dev:", zero_std_dev_min, 3);
-          }
         SERIAL_EOL();
         char mess[21];
         strcpy_P(mess, PSTR("Calibration sd:"));
@@ -644,6 +867,9 @@ void GcodeSuite::G33() {
           sprintf_P(&mess[15], PSTR("%03i.x"), (int)LROUND(zero_std_dev_min));
         ui.set_status(mess);
         print_calibration_settings(_endstop_results, _angle_results);
+        #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+          if (rod_set) SERIAL_ECHOLNPAIR(".Diagonal rod:", delta_diagonal_rod);
+        #endif
         serialprintPGM(save_message);
         SERIAL_EOL();
       }
@@ -38,6 +38,8 @@
  *
  *   C[float] Kc term
  *   L[int] LPQ length
+ *
+ * With PID_PROFILE the cost of the last hotend update is also reported.
  */
 void GcodeSuite::M301() {
 
@@ -69,6 +71,9 @@ void GcodeSuite::M301() {
       SERIAL_ECHOPAIR(" c:", PID_PARAM(Kc, e));
     #endif
     SERIAL_EOL();
+    #if ENABLED(PID_PROFILE)
+      thermalManager.report_pid_profile();
+    #endif
   }
   else
     SERIAL_ERROR_MSG(MSG_INVALID_EXTRUDER);
@@ -27,6 +27,10 @@
 #include "../gcode.h"
 #include "../../module/servo.h"
 
+#if ENABLED(INLINE_OUTPUT_EVENTS)
+  #include "../../module/planner.h"
+#endif
+
 /**
  * M280: Get or set servo position. P<index> [S<angle>]
  */
@@ -36,8 +40,17 @@ void GcodeSuite::M280() {
   if (WITHIN(servo_index, 0, NUM_SERVOS - 1)) {
     if (parser.seen('S')) {
       const int a = parser.value_int();
-      if (a == -1)
+      if (a == -1) {
+        #if ENABLED(INLINE_OUTPUT_EVENTS)
+          planner.synchronize();  // Let queued servo moves finish
+        #endif
         servo[servo_index].detach();
+      }
+      #if ENABLED(INLINE_OUTPUT_EVENTS) && DISABLED(DEACTIVATE_SERVOS_AFTER_MOVE)
+        // Move the servo as the next move starts
+        else if (WITHIN(a, 0, 255) && servo[servo_index].attach(0) >= 0)
+          planner.queue_output_event(OUTPUT_EVENT_SERVO, servo_index, a);
+      #endif
       else
         MOVE_SERVO(servo_index, a);
     }
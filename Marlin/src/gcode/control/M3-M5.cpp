@@ -58,20 +58,44 @@
  *  (usually goes through a reset which sets all I/O pins to tri-state)
  *
  *  PWM duty cycle goes from 0 (off) to 255 (always on).
+ *
+ *  With LASER_POWER_INLINE the new power is stored with the moves that
+ *  follow and applied by the stepper as each move starts. When the planner
+ *  is empty the power is applied at once. There is no power-up delay.
  */
 void GcodeSuite::M3_M4(const bool is_M4) {
 
-  planner.synchronize();   // Wait for previous movement commands (G0/G0/G2/G3) to complete before changing power
+  #if ENABLED(LASER_POWER_INLINE)
+
+    UNUSED(is_M4);
+
+    // The power is carried by the moves that follow, so there's no need to wait for the buffer to empty
+    #if ENABLED(SPINDLE_LASER_PWM)
+      if (parser.seen('O'))
+        cutter.set_inline_ocr(parser.value_byte()); // The OCR is a value from 0 to 255 (uint8_t)
+      else
+        cutter.set_inline_power(parser.intval('S', 255));
+    #else
+      cutter.set_inline_power(255);
+    #endif
 
-  cutter.set_direction(is_M4);
+    if (!planner.has_blocks_queued()) cutter.apply_inline();
 
-  #if ENABLED(SPINDLE_LASER_PWM)
-    if (parser.seen('O'))
-      cutter.set_ocr_power(parser.value_byte()); // The OCR is a value from 0 to 255 (uint8_t)
-    else
-      cutter.set_power(parser.intval('S', 255));
   #else
-    cutter.set_enabled(true);
+
+    planner.synchronize();   // Wait for previous movement commands (G0/G0/G2/G3) to complete before changing power
+
+    cutter.set_direction(is_M4);
+
+    #if ENABLED(SPINDLE_LASER_PWM)
+      if (parser.seen('O'))
+        cutter.set_ocr_power(parser.value_byte()); // The OCR is a value from 0 to 255 (uint8_t)
+      else
+        cutter.set_power(parser.intval('S', 255));
+    #else
+      cutter.set_enabled(true);
+    #endif
+
   #endif
 }
 
@@ -79,8 +103,13 @@ void GcodeSuite::M3_M4(const bool is_M4) {
  * M5 - Cutter OFF
  */
 void GcodeSuite::M5() {
-  planner.synchronize();
-  cutter.set_enabled(false);
+  #if ENABLED(LASER_POWER_INLINE)
+    cutter.set_inline_power(0);
+    if (!planner.has_blocks_queued()) cutter.apply_inline();
+  #else
+    planner.synchronize();
+    cutter.set_enabled(false);
+  #endif
 }
 
 #endif // HAS_CUTTER
@@ -28,6 +28,10 @@
   #include "../../module/temperature.h"
 #endif
 
+#if ENABLED(INLINE_OUTPUT_EVENTS)
+  #include "../../module/planner.h"
+#endif
+
 /**
  * M42: Change pin status via GCode
  *
@@ -49,9 +53,13 @@ void GcodeSuite::M42() {
 
   if (!parser.boolval('I') && pin_is_protected(pin)) return protected_pin_err();
 
-  pinMode(pin, OUTPUT);
-  extDigitalWrite(pin, pin_status);
-  analogWrite(pin, pin_status);
+  #if ENABLED(INLINE_OUTPUT_EVENTS)
+    planner.queue_output_event(OUTPUT_EVENT_PIN, pin, pin_status); // Set the pin as the next move starts
+  #else
+    pinMode(pin, OUTPUT);
+    extDigitalWrite(pin, pin_status);
+    analogWrite(pin, pin_status);
+  #endif
 
   #if FAN_COUNT > 0
     switch (pin) {
@@ -27,13 +27,22 @@
 #include "../gcode.h"
 #include "../../module/planner.h"
 
+#if ENABLED(INLINE_OUTPUT_EVENTS)
+  // Switch coolant as the next move starts
+  #define COOLANT_SYNC() NOOP
+  #define COOLANT_WRITE(P,V) planner.queue_output_event(OUTPUT_EVENT_DIGITAL, P##_PIN, V)
+#else
+  #define COOLANT_SYNC() planner.synchronize()
+  #define COOLANT_WRITE(P,V) WRITE(P##_PIN, V)
+#endif
+
 #if ENABLED(COOLANT_MIST)
   /**
    * M7: Mist Coolant On
    */
   void GcodeSuite::M7() {
-    planner.synchronize();                            // Wait for move to arrive
-    WRITE(COOLANT_MIST_PIN, !(COOLANT_MIST_INVERT));  // Turn on Mist coolant
+    COOLANT_SYNC();                                       // Wait for move to arrive
+    COOLANT_WRITE(COOLANT_MIST, !(COOLANT_MIST_INVERT));  // Turn on Mist coolant
   }
 #endif
 
@@ -42,8 +51,8 @@
    * M8: Flood Coolant On
    */
   void GcodeSuite::M8() {
-    planner.synchronize();                              // Wait for move to arrive
-    WRITE(COOLANT_FLOOD_PIN, !(COOLANT_FLOOD_INVERT));  // Turn on Flood coolant
+    COOLANT_SYNC();                                         // Wait for move to arrive
+    COOLANT_WRITE(COOLANT_FLOOD, !(COOLANT_FLOOD_INVERT));  // Turn on Flood coolant
   }
 #endif
 
@@ -51,12 +60,12 @@
  * M9: Coolant OFF
  */
 void GcodeSuite::M9() {
-  planner.synchronize();                            // Wait for move to arrive
+  COOLANT_SYNC();                                       // Wait for move to arrive
   #if ENABLED(COOLANT_MIST)
-    WRITE(COOLANT_MIST_PIN, COOLANT_MIST_INVERT);   // Turn off Mist coolant
+    COOLANT_WRITE(COOLANT_MIST, COOLANT_MIST_INVERT);   // Turn off Mist coolant
   #endif
   #if ENABLED(COOLANT_FLOOD)
-    WRITE(COOLANT_FLOOD_PIN, COOLANT_FLOOD_INVERT); // Turn off Flood coolant
+    COOLANT_WRITE(COOLANT_FLOOD, COOLANT_FLOOD_INVERT); // Turn off Flood coolant
   #endif
 }
 
@@ -40,6 +40,9 @@
  *  K<factor>   Set current advance K factor (Slot 0).
  *  L<factor>   Set secondary advance K factor (Slot 1). Requires EXTRA_LIN_ADVANCE_K.
  *  S<0/1>      Activate slot 0 or 1. Requires EXTRA_LIN_ADVANCE_K.
+ *
+ *  The planner captures K in each block, so a new value applies to the
+ *  moves that follow without waiting for the buffer to empty.
  */
 void GcodeSuite::M900() {
 
@@ -62,7 +65,6 @@ void GcodeSuite::M900() {
       if (ext_slot != slot) {
         ext_slot = slot;
         SET_BIT_TO(lin_adv_slot, tool_index, slot);
-        planner.synchronize();
         const float temp = planner.extruder_advance_K[tool_index];
         planner.extruder_advance_K[tool_index] = saved_extruder_advance_K[tool_index];
         saved_extruder_advance_K[tool_index] = temp;
@@ -74,10 +76,8 @@ void GcodeSuite::M900() {
       if (WITHIN(newK, 0, 10)) {
         if (ext_slot)
           saved_extruder_advance_K[tool_index] = newK;
-        else {
-          planner.synchronize();
+        else
           planner.extruder_advance_K[tool_index] = newK;
-        }
       }
       else
         SERIAL_ECHOLNPGM("?K value out of range (0-10).");
@@ -88,10 +88,8 @@ void GcodeSuite::M900() {
       if (WITHIN(newL, 0, 10)) {
         if (!ext_slot)
           saved_extruder_advance_K[tool_index] = newL;
-        else {
-          planner.synchronize();
+        else
           planner.extruder_advance_K[tool_index] = newL;
-        }
       }
       else
         SERIAL_ECHOLNPGM("?L value out of range (0-10).");
@@ -115,10 +113,8 @@ void GcodeSuite::M900() {
 
     if (parser.seenval('K')) {
       const float newK = parser.value_float();
-      if (WITHIN(newK, 0, 10)) {
-        planner.synchronize();
+      if (WITHIN(newK, 0, 10))
         planner.extruder_advance_K[tool_index] = newK;
-      }
       else
         SERIAL_ECHOLNPGM("?K value out of range (0-10).");
     }
@@ -29,6 +29,9 @@
 
 #if PIN_EXISTS(CHDK)
   millis_t chdk_timeout; // = 0
+  #if ENABLED(INLINE_OUTPUT_EVENTS)
+    #include "../../../module/planner.h"
+  #endif
 #endif
 
 #ifdef PHOTO_RETRACT_MM
@@ -147,8 +150,12 @@ void GcodeSuite::M240() {
 
   #if PIN_EXISTS(CHDK)
 
-    OUT_WRITE(CHDK_PIN, HIGH);
-    chdk_timeout = millis() + PHOTO_SWITCH_MS;
+    #if ENABLED(INLINE_OUTPUT_EVENTS)
+      planner.queue_output_event(OUTPUT_EVENT_CAMERA, CHDK_PIN, HIGH); // Press the shutter as the next move starts
+    #else
+      OUT_WRITE(CHDK_PIN, HIGH);
+      chdk_timeout = millis() + PHOTO_SWITCH_MS;
+    #endif
 
   #elif HAS_PHOTOGRAPH
 
@@ -55,6 +55,13 @@ void GcodeSuite::M115() {
       #endif
     );
 
+    // BINARY_TELEMETRY (M155 B<ms>)
+    cap_line(PSTR("BINARY_TELEMETRY")
+      #if ENABLED(BINARY_TELEMETRY)
+        , true
+      #endif
+    );
+
     // EEPROM (M500, M501)
     cap_line(PSTR("EEPROM")
       #if ENABLED(EEPROM_SETTINGS)
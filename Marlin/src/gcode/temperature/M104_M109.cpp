@@ -39,6 +39,10 @@
   #include "../../module/tool_change.h"
 #endif
 
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #include "../../feature/tool_preheat.h"
+#endif
+
 /**
  * M104: Set hot end temperature
  */
@@ -61,6 +65,10 @@ void GcodeSuite::M104() {
     #endif
     thermalManager.setTargetHotend(temp, target_extruder);
 
+    #if ENABLED(TOOLCHANGE_PREHEAT)
+      tool_preheat.set_print_temp(target_extruder, temp, false);
+    #endif
+
     #if ENABLED(DUAL_X_CARRIAGE)
       if (dxc_is_duplicating() && target_extruder == 0)
         thermalManager.setTargetHotend(temp ? temp + duplicate_extruder_temp_offset : 0, 1);
@@ -110,6 +118,10 @@ void GcodeSuite::M109() {
     #endif
     thermalManager.setTargetHotend(temp, target_extruder);
 
+    #if ENABLED(TOOLCHANGE_PREHEAT)
+      tool_preheat.set_print_temp(target_extruder, temp, true);
+    #endif
+
     #if ENABLED(DUAL_X_CARRIAGE)
       if (dxc_is_duplicating() && target_extruder == 0)
         thermalManager.setTargetHotend(temp ? temp + duplicate_extruder_temp_offset : 0, 1);
@@ -27,14 +27,26 @@
 #include "../gcode.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(BINARY_TELEMETRY)
+  #include "../../feature/binary_telemetry.h"
+#endif
+
 /**
  * M155: Set temperature auto-report interval. M155 S<seconds>
+ *
+ *  B<ms> - Send binary telemetry frames to this port every <ms> milliseconds. B0 to stop.
+ *          Requires BINARY_TELEMETRY.
  */
 void GcodeSuite::M155() {
 
   if (parser.seenval('S'))
     thermalManager.set_auto_report_interval(parser.value_byte());
 
+  #if ENABLED(BINARY_TELEMETRY)
+    if (parser.seenval('B'))
+      binary_telemetry.set_interval(parser.value_ushort());
+  #endif
+
 }
 
 #endif // AUTO_REPORT_TEMPERATURES && HAS_TEMP_SENSOR
@@ -464,6 +464,19 @@
   #error "Set SERIAL_PORT to the port on your board. Usually this is 0."
 #endif
 
+/**
+ * Binary telemetry
+ */
+#if ENABLED(BINARY_TELEMETRY)
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "BINARY_TELEMETRY requires BINARY_FILE_TRANSFER."
+  #elif DISABLED(AUTO_REPORT_TEMPERATURES) || !HAS_TEMP_SENSOR
+    #error "BINARY_TELEMETRY requires AUTO_REPORT_TEMPERATURES."
+  #elif !defined(BINARY_TELEMETRY_KEYFRAME)
+    #error "BINARY_TELEMETRY requires BINARY_TELEMETRY_KEYFRAME."
+  #endif
+#endif
+
 #if defined(SERIAL_PORT_2) && NUM_SERIAL < 2
   #error "SERIAL_PORT_2 is not supported for your MOTHERBOARD. Disable it to continue."
 #endif
@@ -587,6 +600,17 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+/**
+ * Graphical Display dirty regions
+ */
+#if ENABLED(DOGM_DIRTY_REGIONS)
+  #ifdef __AVR__
+    #error "DOGM_DIRTY_REGIONS requires a 32-bit board."
+  #elif ENABLED(LIGHTWEIGHT_UI)
+    #error "DOGM_DIRTY_REGIONS is not compatible with LIGHTWEIGHT_UI."
+  #endif
+#endif
+
 /**
  * SD File Sorting
  */
@@ -747,6 +771,17 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
       #error "TOOLCHANGE_PARK requires TOOLCHANGE_PARK_XY_FEEDRATE. Please update your Configuration."
     #endif
   #endif
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    #if HOTENDS < 2
+      #error "TOOLCHANGE_PREHEAT requires 2 or more HOTENDS."
+    #elif !defined(TOOLCHANGE_PREHEAT_RATE) || !defined(TOOLCHANGE_PREHEAT_MARGIN) || !defined(TOOLCHANGE_PREHEAT_SCAN_BYTES)
+      #error "TOOLCHANGE_PREHEAT requires TOOLCHANGE_PREHEAT_RATE, TOOLCHANGE_PREHEAT_MARGIN, and TOOLCHANGE_PREHEAT_SCAN_BYTES. Please update your Configuration."
+    #elif !defined(TOOLCHANGE_PREHEAT_STANDBY_TIME) || !defined(TOOLCHANGE_PREHEAT_STANDBY_TEMP)
+      #error "TOOLCHANGE_PREHEAT requires TOOLCHANGE_PREHEAT_STANDBY_TIME and TOOLCHANGE_PREHEAT_STANDBY_TEMP. Please update your Configuration."
+    #elif TOOLCHANGE_PREHEAT_RATE <= 0
+      #error "TOOLCHANGE_PREHEAT_RATE must be greater than 0."
+    #endif
+  #endif
 
   #ifndef TOOLCHANGE_ZRAISE
     #error "TOOLCHANGE_ZRAISE required for EXTRUDERS > 1. Please update your Configuration_adv.h."
@@ -1821,6 +1856,10 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 #elif ENABLED(NEOPIXEL_LED)
   #if !(PIN_EXISTS(NEOPIXEL) && NEOPIXEL_PIXELS > 0)
     #error "NEOPIXEL_LED requires NEOPIXEL_PIN and NEOPIXEL_PIXELS."
+  #elif defined(NEOPIXEL_SPI_PORT) && !defined(__STM32F1__)
+    #error "NEOPIXEL_SPI_PORT is only supported on STM32F1."
+  #elif defined(NEOPIXEL_SPI_PORT) && PIN_EXISTS(NEOPIXEL2)
+    #error "NEOPIXEL_SPI_PORT doesn't support NEOPIXEL2_PIN."
   #endif
 #endif
 #undef _RGB_TEST
@@ -2310,6 +2349,10 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "USB_CS_PIN and USB_INTR_PIN are required for USB_FLASH_DRIVE_SUPPORT."
 #endif
 
+#if ENABLED(USB_FLASH_DRIVE_SUPPORT) && defined(USB_READ_AHEAD_BLOCKS) && !WITHIN(USB_READ_AHEAD_BLOCKS, 1, 64)
+  #error "USB_READ_AHEAD_BLOCKS must be from 1 to 64."
+#endif
+
 #if ENABLED(SD_FIRMWARE_UPDATE) && !defined(__AVR_ATmega2560__)
   #error "SD_FIRMWARE_UPDATE requires an ATmega2560-based (Arduino Mega) board."
 #endif
@@ -2477,3 +2520,16 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #endif
   #undef _PIN_CONFLICT
 #endif
+
+#if ENABLED(LASER_POWER_INLINE) && DISABLED(LASER_FEATURE)
+  #error "LASER_POWER_INLINE requires LASER_FEATURE."
+#elif ENABLED(LASER_POWER_INLINE_TRAPEZOID) && DISABLED(SPINDLE_LASER_PWM)
+  #error "LASER_POWER_INLINE_TRAPEZOID requires SPINDLE_LASER_PWM."
+#endif
+
+/**
+ * Inline Output Events
+ */
+#if ENABLED(INLINE_OUTPUT_EVENTS) && !WITHIN(INLINE_OUTPUT_EVENTS_PER_BLOCK, 1, 16)
+  #error "INLINE_OUTPUT_EVENTS_PER_BLOCK must be from 1 to 16."
+#endif
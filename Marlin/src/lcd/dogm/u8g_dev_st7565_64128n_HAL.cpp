@@ -59,6 +59,7 @@
 
 #include <U8glib.h>
 #include "HAL_LCD_com_defines.h"
+#include "u8g_dirty_regions.h"
 
 #define WIDTH 128
 #define HEIGHT 64
@@ -75,7 +76,9 @@
 #define ST7565_V5_RATIO(N)       (0x20 | ((N) & 0x7))
 #define ST7565_CONTRAST(N)       (0x81), (N)
 
-#define ST7565_COLUMN_ADR(N)     (0x10 | (((N) >> 4) & 0xF)), ((N) & 0xF)
+#define ST7565_COLUMN_HI(N)      (0x10 | (((N) >> 4) & 0xF))
+#define ST7565_COLUMN_LO(N)      ((N) & 0xF)
+#define ST7565_COLUMN_ADR(N)     ST7565_COLUMN_HI(N), ST7565_COLUMN_LO(N)
 #define ST7565_PAGE_ADR(N)       (0xB0 | (N))
 #define ST7565_START_LINE(N)     (0x40 | (N))
 #define ST7565_SLEEP_MODE()      (0xAC) // ,(N) needed?
@@ -148,21 +151,45 @@ static const uint8_t u8g_dev_st7565_64128n_HAL_sleep_off[] PROGMEM = {
   U8G_ESC_END                 // end of sequence
 };
 
+#if ENABLED(DOGM_DIRTY_REGIONS)
+
+  // Send only the changed columns of one 8-row page
+  static void u8g_dev_st7565_64128n_HAL_write_page(u8g_t *u8g, u8g_dev_t *dev, const uint8_t page, const uint8_t *data) {
+    uint8_t first, last;
+    if (!u8g_dirty_span(page * (WIDTH), data, WIDTH, first, last)) return;
+    u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_data_start);
+    u8g_WriteByte(u8g, dev, ST7565_PAGE_ADR(page)); /* select current page (ST7565R) */
+    u8g_WriteByte(u8g, dev, ST7565_COLUMN_HI(first));
+    u8g_WriteByte(u8g, dev, ST7565_COLUMN_LO(first));
+    u8g_SetAddress(u8g, dev, 1);           /* data mode */
+    u8g_WriteSequence(u8g, dev, last - first + 1, (uint8_t *)data + first);
+    u8g_SetChipSelect(u8g, dev, 0);
+  }
+
+#endif
+
 uint8_t u8g_dev_st7565_64128n_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, const uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_init_seq);
+      #if ENABLED(DOGM_DIRTY_REGIONS)
+        u8g_dirty_invalidate();
+      #endif
       break;
     case U8G_DEV_MSG_STOP:
       break;
     case U8G_DEV_MSG_PAGE_NEXT: {
         u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_data_start);
-        u8g_WriteByte(u8g, dev, ST7565_PAGE_ADR(pb->p.page)); /* select current page (ST7565R) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-        if (!u8g_pb_WriteBuffer(pb, u8g, dev)) return 0;
-        u8g_SetChipSelect(u8g, dev, 0);
+        #if ENABLED(DOGM_DIRTY_REGIONS)
+          u8g_dev_st7565_64128n_HAL_write_page(u8g, dev, pb->p.page, (uint8_t *)pb->buf);
+        #else
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_data_start);
+          u8g_WriteByte(u8g, dev, ST7565_PAGE_ADR(pb->p.page)); /* select current page (ST7565R) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          if (!u8g_pb_WriteBuffer(pb, u8g, dev)) return 0;
+          u8g_SetChipSelect(u8g, dev, 0);
+        #endif
       }
       break;
     case U8G_DEV_MSG_CONTRAST:
@@ -187,23 +214,30 @@ uint8_t u8g_dev_st7565_64128n_HAL_2x_fn(u8g_t *u8g, u8g_dev_t *dev, const uint8_
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_init_seq);
+      #if ENABLED(DOGM_DIRTY_REGIONS)
+        u8g_dirty_invalidate();
+      #endif
       break;
     case U8G_DEV_MSG_STOP:
       break;
     case U8G_DEV_MSG_PAGE_NEXT: {
         u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+        #if ENABLED(DOGM_DIRTY_REGIONS)
+          u8g_dev_st7565_64128n_HAL_write_page(u8g, dev, 2 * pb->p.page, (uint8_t *)pb->buf);
+          u8g_dev_st7565_64128n_HAL_write_page(u8g, dev, 2 * pb->p.page + 1, (uint8_t *)(pb->buf) + pb->width);
+        #else
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_data_start);
+          u8g_WriteByte(u8g, dev, ST7565_PAGE_ADR(2 * pb->p.page)); /* select current page (ST7565R) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)pb->buf);
+          u8g_SetChipSelect(u8g, dev, 0);
 
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_data_start);
-        u8g_WriteByte(u8g, dev, ST7565_PAGE_ADR(2 * pb->p.page)); /* select current page (ST7565R) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-        u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)pb->buf);
-        u8g_SetChipSelect(u8g, dev, 0);
-
-        u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_data_start);
-        u8g_WriteByte(u8g, dev, ST7565_PAGE_ADR(2 * pb->p.page + 1)); /* select current page (ST7565R) */
-        u8g_SetAddress(u8g, dev, 1);           /* data mode */
-        u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)(pb->buf)+pb->width);
-        u8g_SetChipSelect(u8g, dev, 0);
+          u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_64128n_HAL_data_start);
+          u8g_WriteByte(u8g, dev, ST7565_PAGE_ADR(2 * pb->p.page + 1)); /* select current page (ST7565R) */
+          u8g_SetAddress(u8g, dev, 1);           /* data mode */
+          u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)(pb->buf)+pb->width);
+          u8g_SetChipSelect(u8g, dev, 0);
+        #endif
       }
       break;
     case U8G_DEV_MSG_CONTRAST:
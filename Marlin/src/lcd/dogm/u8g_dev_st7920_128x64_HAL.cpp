@@ -58,6 +58,7 @@
 #if HAS_GRAPHICAL_LCD
 
 #include "HAL_LCD_com_defines.h"
+#include "u8g_dirty_regions.h"
 
 #define LCD_PIXEL_WIDTH  128
 #define LCD_PIXEL_HEIGHT  64
@@ -103,12 +104,40 @@ void clear_graphics_DRAM(u8g_t *u8g, u8g_dev_t *dev) {
   u8g_SetChipSelect(u8g, dev, 0);
 }
 
+// Send one pixel row, or only the changed 16-pixel words with DOGM_DIRTY_REGIONS
+static void u8g_dev_st7920_128x64_HAL_write_row(u8g_t *u8g, u8g_dev_t *dev, const uint8_t y, const uint8_t *ptr) {
+  uint8_t first = 0, last = (LCD_PIXEL_WIDTH) / 8 - 1;
+  #if ENABLED(DOGM_DIRTY_REGIONS)
+    if (!u8g_dirty_span(y * ((LCD_PIXEL_WIDTH) / 8), ptr, (LCD_PIXEL_WIDTH) / 8, first, last)) return;
+    first &= ~1;                            /* GDRAM is addressed in 16-bit words */
+    last |= 1;
+  #endif
+
+  u8g_SetAddress(u8g, dev, 0);              /* cmd mode */
+  u8g_WriteByte(u8g, dev, 0x03E );          /* enable extended mode */
+
+  if (y < 32) {
+    u8g_WriteByte(u8g, dev, 0x080 | y );    /* y pos  */
+    u8g_WriteByte(u8g, dev, 0x080 | (first / 2)); /* x pos (words) */
+  }
+  else {
+    u8g_WriteByte(u8g, dev, 0x080 | (y-32) ); /* y pos  */
+    u8g_WriteByte(u8g, dev, 0x080 | (8 + first / 2)); /* x pos, lower half starts at 64 */
+  }
+
+  u8g_SetAddress(u8g, dev, 1);              /* data mode */
+  u8g_WriteSequence(u8g, dev, last - first + 1, (uint8_t *)ptr + first);
+}
+
 uint8_t u8g_dev_st7920_128x64_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7920_128x64_HAL_init_seq);
       clear_graphics_DRAM(u8g, dev);
+      #if ENABLED(DOGM_DIRTY_REGIONS)
+        u8g_dirty_invalidate();
+      #endif
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -122,20 +151,7 @@ uint8_t u8g_dev_st7920_128x64_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
       y = pb->p.page_y0;
       ptr = (uint8_t *)pb->buf;
       for (i = 0; i < 8; i ++) {
-        u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
-        u8g_WriteByte(u8g, dev, 0x03E );      /* enable extended mode */
-
-        if (y < 32) {
-          u8g_WriteByte(u8g, dev, 0x080 | y );      /* y pos  */
-          u8g_WriteByte(u8g, dev, 0x080  );      /* set x pos to 0*/
-        }
-        else {
-          u8g_WriteByte(u8g, dev, 0x080 | (y-32) );      /* y pos  */
-          u8g_WriteByte(u8g, dev, 0x080 | 8);      /* set x pos to 64*/
-        }
-
-        u8g_SetAddress(u8g, dev, 1);                  /* data mode */
-        u8g_WriteSequence(u8g, dev, (LCD_PIXEL_WIDTH) / 8, ptr);
+        u8g_dev_st7920_128x64_HAL_write_row(u8g, dev, y, ptr);
         ptr += (LCD_PIXEL_WIDTH) / 8;
         y++;
       }
@@ -152,6 +168,9 @@ uint8_t u8g_dev_st7920_128x64_HAL_4x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7920_128x64_HAL_init_seq);
       clear_graphics_DRAM(u8g, dev);
+      #if ENABLED(DOGM_DIRTY_REGIONS)
+        u8g_dirty_invalidate();
+      #endif
       break;
 
     case U8G_DEV_MSG_STOP:
@@ -167,20 +186,7 @@ uint8_t u8g_dev_st7920_128x64_HAL_4x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
       y = pb->p.page_y0;
       ptr = (uint8_t *)pb->buf;
       for (i = 0; i < 32; i ++) {
-        u8g_SetAddress(u8g, dev, 0);           /* cmd mode */
-        u8g_WriteByte(u8g, dev, 0x03E );      /* enable extended mode */
-
-        if (y < 32) {
-          u8g_WriteByte(u8g, dev, 0x080 | y );      /* y pos  */
-          u8g_WriteByte(u8g, dev, 0x080  );      /* set x pos to 0*/
-        }
-        else {
-          u8g_WriteByte(u8g, dev, 0x080 | (y-32) );      /* y pos  */
-          u8g_WriteByte(u8g, dev, 0x080 | 8);      /* set x pos to 64*/
-        }
-
-        u8g_SetAddress(u8g, dev, 1);                  /* data mode */
-        u8g_WriteSequence(u8g, dev, (LCD_PIXEL_WIDTH) / 8, ptr);
+        u8g_dev_st7920_128x64_HAL_write_row(u8g, dev, y, ptr);
         ptr += (LCD_PIXEL_WIDTH) / 8;
         y++;
       }
@@ -58,6 +58,7 @@
 #if HAS_GRAPHICAL_LCD
 
 #include "HAL_LCD_com_defines.h"
+#include "u8g_dirty_regions.h"
 
 #define WIDTH 128
 #define HEIGHT 64
@@ -74,7 +75,8 @@
 #define UC1701_CONTRAST(N)       (0x81), (N)
 
 #define UC1701_COLUMN_HI(N)      (0x10 | (((N) >> 4) & 0xF))
-#define UC1701_COLUMN_ADR(N)     UC1701_COLUMN_HI(N), ((N) & 0xF)
+#define UC1701_COLUMN_LO(N)      ((N) & 0xF)
+#define UC1701_COLUMN_ADR(N)     UC1701_COLUMN_HI(N), UC1701_COLUMN_LO(N)
 #define UC1701_PAGE_ADR(N)       (0xB0 | (N))
 #define UC1701_START_LINE(N)     (0x40 | (N))
 #define UC1701_INDICATOR(N)      (0xAC), (N)
@@ -136,22 +138,51 @@ static const uint8_t u8g_dev_uc1701_mini12864_HAL_data_start[] PROGMEM = {
   U8G_ESC_END                 // end of sequence
 };
 
+#if ENABLED(DOGM_DIRTY_REGIONS)
+
+  // Send only the changed columns of one 8-row page
+  static void u8g_dev_uc1701_mini12864_HAL_write_page(u8g_t *u8g, u8g_dev_t *dev, const uint8_t page, const uint8_t *data, const bool mks_delay) {
+    uint8_t first, last;
+    if (!u8g_dirty_span(page * (WIDTH), data, WIDTH, first, last)) return;
+    u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
+    #if ENABLED(MKS_MINI_12864)
+      if (mks_delay) u8g_Delay(5);
+    #else
+      UNUSED(mks_delay);
+    #endif
+    u8g_WriteByte(u8g, dev, UC1701_PAGE_ADR(page)); /* select current page */
+    u8g_WriteByte(u8g, dev, UC1701_COLUMN_HI(first));
+    u8g_WriteByte(u8g, dev, UC1701_COLUMN_LO(first));
+    u8g_SetAddress(u8g, dev, 1); /* data mode */
+    u8g_WriteSequence(u8g, dev, last - first + 1, (uint8_t *)data + first);
+    u8g_SetChipSelect(u8g, dev, 0);
+  }
+
+#endif
+
 uint8_t u8g_dev_uc1701_mini12864_HAL_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_init_seq);
+      #if ENABLED(DOGM_DIRTY_REGIONS)
+        u8g_dirty_invalidate();
+      #endif
       break;
 
     case U8G_DEV_MSG_STOP: break;
 
     case U8G_DEV_MSG_PAGE_NEXT: {
       u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-      u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
-      u8g_WriteByte(u8g, dev, 0x0B0 | pb->p.page); /* select current page */
-      u8g_SetAddress(u8g, dev, 1);           /* data mode */
-      if (!u8g_pb_WriteBuffer(pb, u8g, dev)) return 0;
-      u8g_SetChipSelect(u8g, dev, 0);
+      #if ENABLED(DOGM_DIRTY_REGIONS)
+        u8g_dev_uc1701_mini12864_HAL_write_page(u8g, dev, pb->p.page, (uint8_t *)pb->buf, false);
+      #else
+        u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
+        u8g_WriteByte(u8g, dev, UC1701_PAGE_ADR(pb->p.page)); /* select current page */
+        u8g_SetAddress(u8g, dev, 1);           /* data mode */
+        if (!u8g_pb_WriteBuffer(pb, u8g, dev)) return 0;
+        u8g_SetChipSelect(u8g, dev, 0);
+      #endif
     } break;
 
     case U8G_DEV_MSG_CONTRAST:
@@ -173,28 +204,36 @@ uint8_t u8g_dev_uc1701_mini12864_HAL_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
       #if ENABLED(MKS_MINI_12864)
         u8g_Delay(5);
       #endif
+      #if ENABLED(DOGM_DIRTY_REGIONS)
+        u8g_dirty_invalidate();
+      #endif
       break;
 
     case U8G_DEV_MSG_STOP: break;
 
     case U8G_DEV_MSG_PAGE_NEXT: {
       u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-      u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
-      #if ENABLED(MKS_MINI_12864)
-        u8g_Delay(5);
+      #if ENABLED(DOGM_DIRTY_REGIONS)
+        u8g_dev_uc1701_mini12864_HAL_write_page(u8g, dev, 2 * pb->p.page, (uint8_t *)pb->buf, true);
+        u8g_dev_uc1701_mini12864_HAL_write_page(u8g, dev, 2 * pb->p.page + 1, (uint8_t *)(pb->buf) + pb->width, true);
+      #else
+        u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
+        #if ENABLED(MKS_MINI_12864)
+          u8g_Delay(5);
+        #endif
+        u8g_WriteByte(u8g, dev, UC1701_PAGE_ADR(2 * pb->p.page)); /* select current page */
+        u8g_SetAddress(u8g, dev, 1); /* data mode */
+        u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)pb->buf);
+        u8g_SetChipSelect(u8g, dev, 0);
+        u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
+        #if ENABLED(MKS_MINI_12864)
+          u8g_Delay(5);
+        #endif
+        u8g_WriteByte(u8g, dev, UC1701_PAGE_ADR(2 * pb->p.page + 1)); /* select current page */
+        u8g_SetAddress(u8g, dev, 1); /* data mode */
+        u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)(pb->buf)+pb->width);
+        u8g_SetChipSelect(u8g, dev, 0);
       #endif
-      u8g_WriteByte(u8g, dev, 0x0B0 | (2 * pb->p.page)); /* select current page */
-      u8g_SetAddress(u8g, dev, 1); /* data mode */
-      u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)pb->buf);
-      u8g_SetChipSelect(u8g, dev, 0);
-      u8g_WriteEscSeqP(u8g, dev, u8g_dev_uc1701_mini12864_HAL_data_start);
-      #if ENABLED(MKS_MINI_12864)
-        u8g_Delay(5);
-      #endif
-      u8g_WriteByte(u8g, dev, 0x0B0 | (2 * pb->p.page + 1)); /* select current page */
-      u8g_SetAddress(u8g, dev, 1); /* data mode */
-      u8g_WriteSequence(u8g, dev, pb->width, (uint8_t *)(pb->buf)+pb->width);
-      u8g_SetChipSelect(u8g, dev, 0);
     } break;
 
     case U8G_DEV_MSG_CONTRAST:
@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(DOGM_DIRTY_REGIONS)
+
+#include "u8g_dirty_regions.h"
+
+static uint8_t shadow[DOGM_SHADOW_SIZE];
+static bool shadow_valid; // = false
+static uint8_t frames_to_refresh; // = 0
+
+void u8g_dirty_invalidate() { shadow_valid = false; }
+
+bool u8g_dirty_span(const uint16_t offset, const uint8_t *buf, const uint8_t len, uint8_t &first, uint8_t &last) {
+  uint8_t * const sh = &shadow[offset];
+
+  // At the top of each frame count down to the next full refresh
+  if (offset == 0) {
+    if (!shadow_valid || !frames_to_refresh) {
+      shadow_valid = false;
+      frames_to_refresh = DOGM_FULL_REFRESH_FRAMES;
+    }
+    frames_to_refresh--;
+  }
+
+  if (!shadow_valid) {
+    // Sending the whole frame. Mark valid once the last row is copied.
+    for (uint8_t i = 0; i < len; i++) sh[i] = buf[i];
+    if (offset + len >= DOGM_SHADOW_SIZE) shadow_valid = true;
+    first = 0;
+    last = len - 1;
+    return true;
+  }
+
+  uint8_t i = 0;
+  while (i < len && sh[i] == buf[i]) i++;
+  if (i == len) return false;
+  first = i;
+
+  uint8_t j = len - 1;
+  while (sh[j] == buf[j]) j--;
+  last = j;
+
+  for (; i <= j; i++) sh[i] = buf[i];
+  return true;
+}
+
+#endif // DOGM_DIRTY_REGIONS
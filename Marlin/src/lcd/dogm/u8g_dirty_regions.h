@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * u8g_dirty_regions.h
+ *
+ * Shadow copy of the display RAM for the u8g_dev_*_HAL devices.
+ *
+ * u8glib renders the screen one page (stripe) at a time and the device
+ * sends every page to the panel. With DOGM_DIRTY_REGIONS the device first
+ * compares each page row against the shadow copy and only sends the span
+ * of columns that actually changed, skipping the row entirely if nothing
+ * did. Only one graphical display is active in a build, so all devices
+ * share the same shadow buffer.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(DOGM_DIRTY_REGIONS)
+
+#include <stdint.h>
+
+#define DOGM_SHADOW_SIZE ((128 * 64) / 8)
+
+// Resend the whole frame this often, in case the panel lost its contents to noise or a brown-out
+#ifndef DOGM_FULL_REFRESH_FRAMES
+  #define DOGM_FULL_REFRESH_FRAMES 100
+#endif
+
+/**
+ * Compare 'len' bytes of page buffer with the shadow at 'offset'.
+ * Update the shadow and set [first, last] to the changed byte span.
+ * Return false if nothing changed and the row needn't be sent.
+ */
+bool u8g_dirty_span(const uint16_t offset, const uint8_t *buf, const uint8_t len, uint8_t &first, uint8_t &last);
+
+// Forget the display contents, e.g., after init or a screen clear. The next frame is sent in full.
+void u8g_dirty_invalidate();
+
+#endif // DOGM_DIRTY_REGIONS
@@ -41,6 +41,7 @@
 
 #include "ultralcd_DOGM.h"
 #include "u8g_fontutf8.h"
+#include "u8g_dirty_regions.h"
 
 #if ENABLED(SHOW_BOOTSCREEN)
   #include "dogm_Bootscreen.h"
@@ -305,7 +306,12 @@ void MarlinUI::draw_kill_screen() {
   } while (u8g.nextPage());
 }
 
-void MarlinUI::clear_lcd() { } // Automatically cleared by Picture Loop
+// Automatically cleared by Picture Loop. Resend the next frame in full.
+void MarlinUI::clear_lcd() {
+  #if ENABLED(DOGM_DIRTY_REGIONS)
+    u8g_dirty_invalidate();
+  #endif
+}
 
 #if HAS_LCD_MENU
 
@@ -39,6 +39,7 @@
 #include "../../../../module/planner.h"
 #include "../../../../sd/cardreader.h"
 #include "../../../../libs/duration_t.h"
+#include "../../../../libs/crc16.h"
 #include "../../../../module/printcounter.h"
 
 // Preamble... 2 Bytes, usually 0x5A 0xA5, but configurable
@@ -48,6 +49,9 @@ constexpr uint8_t DGUS_HEADER2 = 0xA5;
 constexpr uint8_t DGUS_CMD_WRITEVAR = 0x82;
 constexpr uint8_t DGUS_CMD_READVAR = 0x83;
 
+// Resend all VPs now and then, in case the display was reset
+constexpr millis_t DGUS_REFRESH_INTERVAL_MS = 5000;
+
 #if ENABLED(DEBUG_DGUSLCD)
   bool dguslcd_local_debug; // = false;
 #endif
@@ -77,6 +81,14 @@ uint8_t DGUSDisplay::rx_datagram_len = 0;
 bool DGUSDisplay::Initialized = false;
 bool DGUSDisplay::no_reentrance = false;
 
+DGUSDisplay::shadow_t DGUSDisplay::shadow[SHADOW_SIZE];
+uint8_t DGUSDisplay::shadow_next; // = 0
+bool DGUSDisplay::coalescing; // = false
+uint16_t DGUSDisplay::pending_adr;
+uint8_t DGUSDisplay::pending_len, DGUSDisplay::pending_data[PENDING_SIZE];
+uint16_t DGUSDisplay::tx_bytes, DGUSDisplay::tx_bytes_per_s;
+millis_t DGUSDisplay::next_rate_ms;
+
 #if DGUS_RX_BUFFER_SIZE > 256
   typedef uint16_t r_ring_buffer_pos_t;
 #else
@@ -635,6 +647,7 @@ void DGUSScreenVariableHandler::UpdateNewScreen(DGUSLCD_Screens newscreen, bool
 
   current_screen = newscreen;
   skipVP = 0;
+  dgusdisplay.InvalidateVP();
   ForceCompleteUpdate();
 }
 
@@ -703,6 +716,14 @@ void DGUSDisplay::loop() {
     ProcessRx();
     no_reentrance = false;
   }
+
+  const millis_t ms = millis();
+  if (ELAPSED(ms, next_rate_ms)) {
+    next_rate_ms = ms + 1000;
+    tx_bytes_per_s = tx_bytes;
+    tx_bytes = 0;
+    if (tx_bytes_per_s) DEBUG_ECHOLNPAIR("DGUS Tx bytes/s: ", tx_bytes_per_s);
+  }
 }
 
 void DGUSDisplay::InitDisplay() {
@@ -718,31 +739,86 @@ void DGUSDisplay::InitDisplay() {
 void DGUSDisplay::WriteVariable(uint16_t adr, const void* values, uint8_t valueslen, bool isstr) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = myvalues ? false : true;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  uint8_t data[VP_MAX_LEN];
+  NOMORE(valueslen, VP_MAX_LEN);
+  for (uint8_t i = 0; i < valueslen; i++) {
     char x;
     if (!strend) x = *myvalues++;
     if ((isstr && !x) || strend) {
       strend = true;
       x = ' ';
     }
-    dgusserial.write(x);
+    data[i] = x;
   }
+  WriteData(adr, data, valueslen);
 }
 
 void DGUSDisplay::WriteVariablePGM(uint16_t adr, const void* values, uint8_t valueslen, bool isstr) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = myvalues ? false : true;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  uint8_t data[VP_MAX_LEN];
+  NOMORE(valueslen, VP_MAX_LEN);
+  for (uint8_t i = 0; i < valueslen; i++) {
     char x;
     if (!strend) x = pgm_read_byte(myvalues++);
     if ((isstr && !x) || strend) {
       strend = true;
       x = ' ';
     }
-    dgusserial.write(x);
+    data[i] = x;
+  }
+  WriteData(adr, data, valueslen);
+}
+
+void DGUSDisplay::InvalidateVP(const uint16_t vp) {
+  for (uint8_t i = 0; i < SHADOW_SIZE; i++)
+    if (!vp || shadow[i].vp == vp) shadow[i].vp = 0;
+}
+
+// Write a VP, or while coalescing add it to the pending write.
+// The shadow keeps a CRC of the last value written, so a screen
+// update can drop VPs that haven't changed.
+void DGUSDisplay::WriteData(const uint16_t adr, const uint8_t *data, const uint8_t len) {
+  uint16_t crc = 0;
+  crc16(&crc, data, len);
+
+  shadow_t *sh = nullptr;
+  for (uint8_t i = 0; i < SHADOW_SIZE; i++)
+    if (shadow[i].vp == adr) { sh = &shadow[i]; break; }
+
+  if (coalescing) {
+    if (sh && sh->crc == crc) return;   // The display shows this already
+    if (!sh) {
+      sh = &shadow[shadow_next];
+      if (++shadow_next >= SHADOW_SIZE) shadow_next = 0;
+      sh->vp = adr;
+    }
   }
+  if (sh) sh->crc = crc;
+
+  // VP addresses count words, so only a whole number of words can be extended
+  if (pending_len && (TEST(pending_len, 0) || adr != pending_adr + pending_len / 2 || pending_len + len > PENDING_SIZE))
+    FlushPending();
+
+  if (coalescing && len <= PENDING_SIZE) {
+    if (!pending_len) pending_adr = adr;
+    memcpy(&pending_data[pending_len], data, len);
+    pending_len += len;
+  }
+  else
+    SendData(adr, data, len);
+}
+
+void DGUSDisplay::FlushPending() {
+  if (!pending_len) return;
+  SendData(pending_adr, pending_data, pending_len);
+  pending_len = 0;
+}
+
+void DGUSDisplay::SendData(const uint16_t adr, const uint8_t *data, const uint8_t len) {
+  WriteHeader(adr, DGUS_CMD_WRITEVAR, len);
+  for (uint8_t i = 0; i < len; i++) dgusserial.write(data[i]);
+  tx_bytes += 6 + len;
 }
 
 void DGUSScreenVariableHandler::GotoScreen(DGUSLCD_Screens screen, bool ispopup) {
@@ -756,9 +832,17 @@ bool DGUSScreenVariableHandler::loop() {
   const millis_t ms = millis();
   static millis_t next_event_ms = 0;
 
+  static millis_t next_refresh_ms = 0;
+
   if (!IsScreenComplete() || ELAPSED(ms, next_event_ms)) {
     next_event_ms = ms + DGUS_UPDATE_INTERVAL_MS;
+    if (ELAPSED(ms, next_refresh_ms)) {
+      next_refresh_ms = ms + DGUS_REFRESH_INTERVAL_MS;
+      dgusdisplay.InvalidateVP();
+    }
+    dgusdisplay.BeginUpdate();
     UpdateScreenVPData();
+    dgusdisplay.EndUpdate();
   }
 
   #if ENABLED(SHOW_BOOTSCREEN)
@@ -848,6 +932,7 @@ void DGUSDisplay::ProcessRx() {
           const uint8_t dlen = tmp[2] << 1;  // Convert to Bytes. (Display works with words)
           //DEBUG_ECHOPAIR(" vp=", vp, " dlen=", dlen);
           DGUS_VP_Variable ramcopy;
+          InvalidateVP(vp); // The display has changed it
           if (populate_VPVar(vp, &ramcopy)) {
             if (!(dlen == ramcopy.size || (dlen == 2 && ramcopy.size == 1)))
               DEBUG_ECHOLNPGM("SIZE MISMATCH");
@@ -870,7 +955,12 @@ void DGUSDisplay::ProcessRx() {
   }
 }
 
-size_t DGUSDisplay::GetFreeTxBuffer() { return dgusserial.GetTxBufferFree(); }
+// Less the pending write, which is still to be sent
+size_t DGUSDisplay::GetFreeTxBuffer() {
+  const size_t tx_free = dgusserial.GetTxBufferFree(),
+               pending = pending_len ? pending_len + 6 : 0;
+  return tx_free > pending ? tx_free - pending : 0;
+}
 
 void DGUSDisplay::WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen) {
   dgusserial.write(DGUS_HEADER1);
@@ -56,6 +56,14 @@ public:
     WriteVariable(adr, static_cast<const void*>(&value), sizeof(T));
   }
 
+  // Collect the writes of a screen update between these two calls.
+  // VPs the display already shows are dropped, and writes to adjacent VPs are sent as one.
+  static void BeginUpdate() { coalescing = true; }
+  static void EndUpdate() { FlushPending(); coalescing = false; }
+
+  // Forget the values sent, so the next update sends them all again. (0 = all VPs)
+  static void InvalidateVP(const uint16_t vp=0);
+
   // Until now I did not need to actively read from the display. That's why there is no ReadVariable
   // (I extensively use the auto upload of the display)
 
@@ -75,11 +83,35 @@ public:
   // (both boils down that the display answered to our chatting)
   static inline bool isInitialized() { return Initialized; }
 
+  // Bytes sent to the display during the last full second
+  static inline uint16_t GetTxBytesPerSecond() { return tx_bytes_per_s; }
+
 private:
   static void WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen);
   static void WritePGM(const char str[], uint8_t len);
+  static void WriteData(const uint16_t adr, const uint8_t *data, const uint8_t len);
+  static void SendData(const uint16_t adr, const uint8_t *data, const uint8_t len);
+  static void FlushPending();
   static void ProcessRx();
 
+  // Last value sent to each VP, as a CRC16 of the payload
+  static constexpr uint8_t SHADOW_SIZE = 32;
+  typedef struct { uint16_t vp, crc; } shadow_t;
+  static shadow_t shadow[SHADOW_SIZE];
+  static uint8_t shadow_next;
+
+  // Longest value WriteVariable sends. Longer ones are cut to this size.
+  static constexpr uint8_t VP_MAX_LEN = 64;
+
+  // Write being collected while coalescing
+  static constexpr uint8_t PENDING_SIZE = 64;
+  static bool coalescing;
+  static uint16_t pending_adr;
+  static uint8_t pending_len, pending_data[PENDING_SIZE];
+
+  static uint16_t tx_bytes, tx_bytes_per_s;
+  static millis_t next_rate_ms;
+
   static rx_datagram_state_t rx_datagram_state;
   static uint8_t rx_datagram_len;
   static bool Initialized, no_reentrance;
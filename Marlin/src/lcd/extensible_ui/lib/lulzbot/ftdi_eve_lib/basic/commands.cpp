@@ -217,6 +217,8 @@ void CLCD::mem_write_32 (uint32_t reg_address, uint32_t data) {
 uint32_t CLCD::CommandFifo::command_write_ptr = 0xFFFFFFFFul;
 #endif
 
+uint32_t CLCD::CommandFifo::bytes_written = 0;
+
 void CLCD::CommandFifo::cmd(uint32_t cmd32) {
   write((void*)&cmd32, sizeof(uint32_t));
 }
@@ -973,6 +975,7 @@ template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
   const uint8_t padding = MULTIPLE_OF_4(len) - len;
 
   uint8_t pad_bytes[] = {0, 0, 0, 0};
+  bytes_written += len + padding;
   return _write_unaligned(data,      len) &&
          _write_unaligned(pad_bytes, padding);
 }
@@ -1032,6 +1035,7 @@ template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
     #endif
   }
   mem_write_bulk(REG::CMDB_WRITE, data, len, padding);
+  bytes_written += len + padding;
   return true;
 }
 #endif
@@ -184,6 +184,8 @@ class CLCD::CommandFifo {
   public:
     template <class T> bool write(T data, uint16_t len);
 
+    static uint32_t bytes_written; // Total bytes sent to the FIFO, for statistics
+
   public:
     CommandFifo() {start();}
 
@@ -96,9 +96,12 @@ bool DLCache::wait_until_idle() {
  * If num_bytes is provided, then that many bytes
  * will be reserved so that the cache may be re-written
  * later with potentially a bigger DL.
+ *
+ * If dl_start is provided, only the part of the DL
+ * following that offset is stored.
  */
 
-bool DLCache::store(uint32_t num_bytes /* = 0*/) {
+bool DLCache::store(uint32_t num_bytes /* = 0*/, uint32_t dl_start /* = 0*/) {
   CLCD::CommandFifo cmd;
 
   // Execute any commands already in the FIFO
@@ -107,7 +110,7 @@ bool DLCache::store(uint32_t num_bytes /* = 0*/) {
     return false;
 
   // Figure out how long the display list is
-  uint32_t new_dl_size = CLCD::mem_read_32(REG::CMD_DL) & 0x1FFF;
+  uint32_t new_dl_size = (CLCD::mem_read_32(REG::CMD_DL) & 0x1FFF) - dl_start;
   uint32_t free_space  = 0;
   uint32_t dl_alloc    = 0;
 
@@ -132,6 +135,7 @@ bool DLCache::store(uint32_t num_bytes /* = 0*/) {
       SERIAL_ECHOLNPAIR("Not enough space in GRAM to cache display list, free space: ", free_space,
                         " Required: ", dl_size);
     #endif
+    if (dl_alloc > 0) dl_addr = 0; // Nothing was allocated
     return false;
   } else {
     #if ENABLED(TOUCH_UI_DEBUG)
@@ -139,7 +143,7 @@ bool DLCache::store(uint32_t num_bytes /* = 0*/) {
       SERIAL_ECHOLNPAIR("Saving DL to RAMG cache, bytes: ", dl_size,
                         " Free space: ", free_space);
     #endif
-    cmd.memcpy(dl_addr, MAP::RAM_DL, dl_size);
+    cmd.memcpy(dl_addr, MAP::RAM_DL + dl_start, dl_size);
     cmd.execute();
     save_slot(dl_slot, dl_addr, dl_size);
     if (dl_alloc > 0) {
@@ -150,6 +154,23 @@ bool DLCache::store(uint32_t num_bytes /* = 0*/) {
   }
 }
 
+// Returns the current length of the DL, once the
+// commands already in the FIFO have been executed.
+
+uint32_t DLCache::dl_offset() {
+  CLCD::CommandFifo cmd;
+  cmd.execute();
+  wait_until_idle();
+  return CLCD::mem_read_32(REG::CMD_DL) & 0x1FFF;
+}
+
+// Marks the slot as empty, but keeps its memory for the next store()
+
+void DLCache::clear() {
+  dl_size = 0;
+  save_slot(dl_slot, dl_addr, 0);
+}
+
 void DLCache::save_slot(uint8_t dl_slot, uint32_t dl_addr, uint32_t dl_size) {
   CLCD::mem_write_32(DL_CACHE_START + dl_slot * 8 + 0, dl_addr);
   CLCD::mem_write_32(DL_CACHE_START + dl_slot * 8 + 4, dl_size);
@@ -172,4 +193,25 @@ void DLCache::append() {
   #endif
 }
 
+/* Appends the widget from the cache if it hasn't changed
+ * and returns false, otherwise returns true after noting
+ * where the widget will begin in the DL.
+ */
+
+bool DLSegment::begin() {
+  if (has_data() && checksum == last_checksum) {
+    append();
+    return false;
+  }
+  dl_start = dl_offset();
+  return true;
+}
+
+void DLSegment::store(uint32_t num_bytes) {
+  if (DLCache::store(num_bytes, dl_start))
+    last_checksum = checksum;
+  else
+    clear(); // Too big to cache, so draw it every time
+}
+
 #endif // FTDI_EXTENDED
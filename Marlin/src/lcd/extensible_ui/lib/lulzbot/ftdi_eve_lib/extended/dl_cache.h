@@ -40,7 +40,7 @@
  *     }
  */
 class DLCache {
-  private:
+  protected:
     typedef FTDI::ftdi_registers  REG;
     typedef FTDI::ftdi_memory_map MAP;
 
@@ -51,10 +51,11 @@ class DLCache {
     void load_slot();
     static void save_slot(uint8_t dl_slot, uint32_t dl_addr, uint32_t dl_size);
 
-    bool wait_until_idle();
+    static bool wait_until_idle();
 
   public:
     static void init();
+    static uint32_t dl_offset();
 
     DLCache(uint8_t slot) {
       dl_slot = slot;
@@ -62,8 +63,39 @@ class DLCache {
     }
 
     bool has_data();
-    bool store(uint32_t num_bytes = 0);
+    bool store(uint32_t num_bytes = 0, uint32_t dl_start = 0);
     void append();
+    void clear();
+};
+
+/* A DLSegment caches the part of the display list drawn by one widget,
+ * so the widget is only redrawn when its contents change. The caller
+ * passes a checksum of the contents and a variable that keeps the
+ * checksum of the cached copy:
+ *
+ *   void draw_widget() {
+ *     DLSegment segment(UNIQUE_ID, checksum, last_checksum);
+ *
+ *     if (segment.begin()) {
+ *        // Add the widget to the DL
+ *        segment.store(NUM_BYTES);
+ *     }
+ *   }
+ *
+ * Widgets should not leave graphics state behind, as the segments
+ * that follow may be appended from the cache.
+ */
+class DLSegment : public DLCache {
+  private:
+    uint16_t checksum, &last_checksum;
+    uint32_t dl_start;
+
+  public:
+    DLSegment(uint8_t slot, uint16_t checksum, uint16_t &last_checksum) :
+      DLCache(slot), checksum(checksum), last_checksum(last_checksum) {}
+
+    bool begin();
+    void store(uint32_t num_bytes);
 };
 
 #define DL_CACHE_SLOTS   250
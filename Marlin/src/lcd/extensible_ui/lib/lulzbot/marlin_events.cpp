@@ -72,13 +72,19 @@ namespace ExtUI {
 
   void onPrintTimerStarted() {
     InterfaceSoundsScreen::playEventSound(InterfaceSoundsScreen::PRINTING_STARTED);
+    if (AT_SCREEN(StatusScreen))
+      current_screen.onRefresh(); // Only the changed widgets are resent
   }
 
   void onPrintTimerStopped() {
     InterfaceSoundsScreen::playEventSound(InterfaceSoundsScreen::PRINTING_FINISHED);
+    if (AT_SCREEN(StatusScreen))
+      current_screen.onRefresh();
   }
 
   void onPrintTimerPaused() {
+    if (AT_SCREEN(StatusScreen))
+      current_screen.onRefresh();
   }
 
   void onFilamentRunout(const extruder_t extruder) {
@@ -53,7 +53,7 @@ void DeveloperMenu::onRedraw(draw_mode_t what) {
 
     cmd.cmd(COLOR_RGB(bg_text_enabled));
     #ifdef TOUCH_UI_PORTRAIT
-      #define GRID_ROWS 10
+      #define GRID_ROWS 11
       #define GRID_COLS 1
       cmd.font(font_large)         .text  ( BTN_POS(1,1), BTN_SIZE(1,1), F("Developer Menu"))
          .colors(normal_btn)
@@ -68,8 +68,9 @@ void DeveloperMenu::onRedraw(draw_mode_t what) {
 
          .tag(1).colors(action_btn)
                                    .button( BTN_POS(1,10), BTN_SIZE(1,1), F("Back"));
+      #define STATS_POS BTN_POS(1,11), BTN_SIZE(1,1)
     #else
-      #define GRID_ROWS 6
+      #define GRID_ROWS 7
       #define GRID_COLS 2
       cmd.font(font_medium)        .text  ( BTN_POS(1,1), BTN_SIZE(2,1), F("Developer Menu"))
          .colors(normal_btn)
@@ -83,6 +84,16 @@ void DeveloperMenu::onRedraw(draw_mode_t what) {
          .tag(8).enabled(has_flash).button( BTN_POS(2,5), BTN_SIZE(1,1), F("Erase SPI Flash"))
          .tag(1).colors(action_btn)
                                    .button( BTN_POS(1,6), BTN_SIZE(2,1), F("Back"));
+      #define STATS_POS BTN_POS(1,7), BTN_SIZE(2,1)
+    #endif
+
+    #ifndef LULZBOT_USE_BIOPRINTER_UI
+      // Cost of the last status screen refresh
+      char stats[40];
+      sprintf_P(stats, PSTR("Status refresh: %lu bytes, %u ms"),
+        (unsigned long)StatusScreen::refresh_bytes, StatusScreen::refresh_ms);
+      cmd.cmd(COLOR_RGB(bg_text_enabled))
+         .tag(0).font(font_small).text(STATS_POS, stats);
     #endif
   }
 }
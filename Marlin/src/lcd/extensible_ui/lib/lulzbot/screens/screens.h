@@ -37,6 +37,12 @@ extern tiny_timer_t refresh_timer;
 
 enum {
   STATUS_SCREEN_CACHE,
+#ifndef LULZBOT_USE_BIOPRINTER_UI
+  STATUS_TEMPERATURE_CACHE,
+  STATUS_PROGRESS_CACHE,
+  STATUS_AXIS_POSITION_CACHE,
+  STATUS_BUTTONS_CACHE,
+#endif
   MENU_SCREEN_CACHE,
   TUNE_SCREEN_CACHE,
   ADJUST_OFFSETS_SCREEN_CACHE,
@@ -89,6 +95,9 @@ enum {
 #define FILE_SCREEN_DL_SIZE          3072
 #define PRINTING_SCREEN_DL_SIZE      2048
 
+// Space reserved for each widget of the status screen
+#define STATUS_WIDGET_DL_SIZE        1024
+
 /************************* MENU SCREEN DECLARATIONS *************************/
 
 class BaseScreen : public UIScreen {
@@ -221,11 +230,20 @@ class StatusScreen : public BaseScreen, public CachedScreen<STATUS_SCREEN_CACHE,
     static void draw_interaction_buttons(draw_mode_t);
     static void draw_status_message(draw_mode_t, const char * const);
 
+    // Checksums of the widgets in the DL cache
+    static uint16_t temperature_checksum, progress_checksum,
+                    axis_position_checksum, buttons_checksum;
+
   public:
+    // Statistics of the last refresh, for the developer menu
+    static uint32_t refresh_bytes;
+    static uint16_t refresh_ms;
+
     static void loadBitmaps();
     static void setStatusMessage(const char *);
     static void setStatusMessage(progmem_str);
     static void onRedraw(draw_mode_t);
+    static void onRefresh();
     static void onStartup();
     static void onEntry();
     static void onIdle();
@@ -28,10 +28,24 @@
 #include "screen_data.h"
 
 #include "../archim2-flash/flash_storage.h"
+#include "../../../../../libs/crc16.h"
 
 using namespace FTDI;
 using namespace Theme;
 
+uint16_t StatusScreen::temperature_checksum,
+         StatusScreen::progress_checksum,
+         StatusScreen::axis_position_checksum,
+         StatusScreen::buttons_checksum;
+
+uint32_t StatusScreen::refresh_bytes;
+uint16_t StatusScreen::refresh_ms;
+
+// Add a string to the checksum of a widget
+static void add_checksum(uint16_t &checksum, const char * const str) {
+  crc16(&checksum, str, strlen(str) + 1);
+}
+
 #ifdef TOUCH_UI_PORTRAIT
   #define GRID_ROWS 8
 #else
@@ -101,16 +115,27 @@ void StatusScreen::draw_axis_position(draw_mode_t what) {
     else
       strcpy_P(z_str, PSTR("?"));
 
-    cmd.tag(6).font(Theme::font_medium)
-    #ifdef TOUCH_UI_PORTRAIT
-         .text  ( BTN_POS(2,5), BTN_SIZE(2,1), x_str)
-         .text  ( BTN_POS(2,6), BTN_SIZE(2,1), y_str)
-         .text  ( BTN_POS(2,7), BTN_SIZE(2,1), z_str);
-    #else
-         .text  ( BTN_POS(1,6), BTN_SIZE(1,1), x_str)
-         .text  ( BTN_POS(2,6), BTN_SIZE(1,1), y_str)
-         .text  ( BTN_POS(3,6), BTN_SIZE(1,1), z_str);
-    #endif
+    uint16_t checksum = 0;
+    add_checksum(checksum, x_str);
+    add_checksum(checksum, y_str);
+    add_checksum(checksum, z_str);
+
+    DLSegment segment(STATUS_AXIS_POSITION_CACHE, checksum, axis_position_checksum);
+    if (segment.begin()) {
+      cmd.cmd(SAVE_CONTEXT())
+         .tag(6).font(Theme::font_medium)
+      #ifdef TOUCH_UI_PORTRAIT
+           .text  ( BTN_POS(2,5), BTN_SIZE(2,1), x_str)
+           .text  ( BTN_POS(2,6), BTN_SIZE(2,1), y_str)
+           .text  ( BTN_POS(2,7), BTN_SIZE(2,1), z_str);
+      #else
+           .text  ( BTN_POS(1,6), BTN_SIZE(1,1), x_str)
+           .text  ( BTN_POS(2,6), BTN_SIZE(1,1), y_str)
+           .text  ( BTN_POS(3,6), BTN_SIZE(1,1), z_str);
+      #endif
+      cmd.cmd(RESTORE_CONTEXT());
+      segment.store(STATUS_WIDGET_DL_SIZE);
+    }
   }
 
   #undef GRID_COLS
@@ -210,12 +235,24 @@ void StatusScreen::draw_temperature(draw_mode_t what) {
       );
     #endif
 
-    cmd.tag(5)
-       .font(font_medium)
-       .text(BTN_POS(2,1), BTN_SIZE(3,1), e0_str)
-       .text(BTN_POS(6,1), BTN_SIZE(3,1), e1_str)
-       .text(BTN_POS(2,2), BTN_SIZE(3,1), bed_str)
-       .text(BTN_POS(6,2), BTN_SIZE(3,1), fan_str);
+    uint16_t checksum = 0;
+    add_checksum(checksum, e0_str);
+    add_checksum(checksum, e1_str);
+    add_checksum(checksum, bed_str);
+    add_checksum(checksum, fan_str);
+
+    DLSegment segment(STATUS_TEMPERATURE_CACHE, checksum, temperature_checksum);
+    if (segment.begin()) {
+      cmd.cmd(SAVE_CONTEXT())
+         .tag(5)
+         .font(font_medium)
+         .text(BTN_POS(2,1), BTN_SIZE(3,1), e0_str)
+         .text(BTN_POS(6,1), BTN_SIZE(3,1), e1_str)
+         .text(BTN_POS(2,2), BTN_SIZE(3,1), bed_str)
+         .text(BTN_POS(6,2), BTN_SIZE(3,1), fan_str)
+         .cmd(RESTORE_CONTEXT());
+      segment.store(STATUS_WIDGET_DL_SIZE);
+    }
   }
 }
 
@@ -247,14 +284,24 @@ void StatusScreen::draw_progress(draw_mode_t what) {
     sprintf_P(time_str,     PSTR(" %02d : %02d"), hrs, min);
     sprintf_P(progress_str, PSTR("%-3d %%"),      getProgress_percent() );
 
-    cmd.font(font_medium)
-    #ifdef TOUCH_UI_PORTRAIT
-       .tag(0).text(BTN_POS(1,3), BTN_SIZE(4,1), time_str)
-              .text(BTN_POS(5,3), BTN_SIZE(4,1), progress_str);
-    #else
-       .tag(0).text(BTN_POS(9,1), BTN_SIZE(4,1), time_str)
-              .text(BTN_POS(9,2), BTN_SIZE(4,1), progress_str);
-    #endif
+    uint16_t checksum = 0;
+    add_checksum(checksum, time_str);
+    add_checksum(checksum, progress_str);
+
+    DLSegment segment(STATUS_PROGRESS_CACHE, checksum, progress_checksum);
+    if (segment.begin()) {
+      cmd.cmd(SAVE_CONTEXT())
+         .font(font_medium)
+      #ifdef TOUCH_UI_PORTRAIT
+         .tag(0).text(BTN_POS(1,3), BTN_SIZE(4,1), time_str)
+                .text(BTN_POS(5,3), BTN_SIZE(4,1), progress_str);
+      #else
+         .tag(0).text(BTN_POS(9,1), BTN_SIZE(4,1), time_str)
+                .text(BTN_POS(9,2), BTN_SIZE(4,1), progress_str);
+      #endif
+      cmd.cmd(RESTORE_CONTEXT());
+      segment.store(STATUS_WIDGET_DL_SIZE);
+    }
   }
 }
 
@@ -268,8 +315,16 @@ void StatusScreen::draw_interaction_buttons(draw_mode_t what) {
 
     const bool has_media = isMediaInserted() && !isPrintingFromMedia();
 
+    const uint8_t state[] = { has_media, isPrintingFromMedia(), EventLoop::get_pressed_tag() };
+    uint16_t checksum = 0;
+    crc16(&checksum, state, sizeof(state));
+
+    DLSegment segment(STATUS_BUTTONS_CACHE, checksum, buttons_checksum);
+    if (!segment.begin()) return;
+
     CommandProcessor cmd;
-    cmd.colors(normal_btn)
+    cmd.cmd(SAVE_CONTEXT())
+       .colors(normal_btn)
        .font(Theme::font_medium)
        .enabled(has_media)
        .colors(has_media ? action_btn : normal_btn)
@@ -286,6 +341,8 @@ void StatusScreen::draw_interaction_buttons(draw_mode_t what) {
       #else
        .tag(4).button( BTN_POS(3,7), BTN_SIZE(2,2), GET_TEXTF(MENU));
     #endif
+    cmd.cmd(RESTORE_CONTEXT());
+    segment.store(STATUS_WIDGET_DL_SIZE);
   }
   #undef  GRID_COLS
 }
@@ -371,7 +428,23 @@ void StatusScreen::onRedraw(draw_mode_t what) {
   }
 }
 
+/* Only the widgets whose contents have changed are sent, the
+ * others are appended from the DL cache.
+ */
+void StatusScreen::onRefresh() {
+  const uint32_t start_bytes = CLCD::CommandFifo::bytes_written,
+                 start_time  = millis();
+
+  CachedScreen::onRefresh();
+
+  refresh_ms    = millis() - start_time;
+  refresh_bytes = CLCD::CommandFifo::bytes_written - start_bytes;
+}
+
 void StatusScreen::onEntry() {
+  // Redraw all widgets, in case the language or theme was changed
+  for (uint8_t slot = STATUS_TEMPERATURE_CACHE; slot <= STATUS_BUTTONS_CACHE; slot++)
+    DLCache(slot).clear();
   onRefresh();
 }
 
@@ -1026,7 +1026,7 @@ void MarlinUI::init() {
   ExtUI::onStartup();
 }
 
-void MarlinUI::update() {
+void MarlinUI::update(const bool can_redraw/*=true*/) {
   #if ENABLED(SDSUPPORT)
     static bool last_sd_status;
     const bool sd_status = IS_SD_INSERTED();
@@ -1046,7 +1046,7 @@ void MarlinUI::update() {
       }
     }
   #endif // SDSUPPORT
-  ExtUI::onIdle();
+  if (can_redraw) ExtUI::onIdle();
 }
 
 void MarlinUI::kill_screen(PGM_P const msg) {
@@ -731,15 +731,19 @@ void MarlinUI::quick_feedback(const bool clear_buttons/*=true*/) {
  *   - Clear the LCD if lcdDrawUpdate == LCDVIEW_CLEAR_CALL_REDRAW
  *   - Update lcdDrawUpdate for the next loop (i.e., move one state down, usually)
  *
+ * With can_redraw false the buttons, encoder, SD detect and menu timeout are
+ * still handled, but drawing waits for the next call that allows it.
+ *
  * This function is only called from the main thread.
  */
 
 LCDViewAction MarlinUI::lcdDrawUpdate = LCDVIEW_CLEAR_CALL_REDRAW;
 
-void MarlinUI::update() {
+void MarlinUI::update(const bool can_redraw/*=true*/) {
 
   static uint16_t max_display_update_time = 0;
   static millis_t next_lcd_update_ms;
+  static bool redraw_deferred; // = false
   millis_t ms = millis();
 
   #if HAS_LCD_MENU && LCD_TIMEOUT_TO_STATUS
@@ -874,11 +878,13 @@ void MarlinUI::update() {
 
   #endif // INIT_SDCARD_ON_BOOT
 
-  if (ELAPSED(ms, next_lcd_update_ms)
+  // A deferred or unfinished draw goes on as soon as it's allowed. Until then
+  // keep to the interval so the timers below don't tick on every call.
+  if (ELAPSED(ms, next_lcd_update_ms) || (can_redraw && (redraw_deferred
     #if HAS_GRAPHICAL_LCD
       || drawing_screen
     #endif
-  ) {
+  ))) {
 
     next_lcd_update_ms = ms + LCD_UPDATE_INTERVAL;
 
@@ -984,7 +990,10 @@ void MarlinUI::update() {
     // then we want to use 1/2 of the time only.
     uint16_t bbr2 = planner.block_buffer_runtime() >> 1;
 
-    if ((should_draw() || drawing_screen) && (!bbr2 || bbr2 > max_display_update_time)) {
+    // Draw on the next call that allows it, not the next interval
+    redraw_deferred = !can_redraw;
+
+    if (can_redraw && (should_draw() || drawing_screen) && (!bbr2 || bbr2 > max_display_update_time)) {
 
       // Change state of drawing flag between screen updates
       if (!drawing_screen) switch (lcdDrawUpdate) {
@@ -1057,7 +1066,7 @@ void MarlinUI::update() {
     #endif
 
     // Change state of drawing flag between screen updates
-    if (!drawing_screen) switch (lcdDrawUpdate) {
+    if (can_redraw && !drawing_screen) switch (lcdDrawUpdate) {
       case LCDVIEW_CLEAR_CALL_REDRAW:
         clear_lcd(); break;
       case LCDVIEW_REDRAW_NOW:
@@ -273,7 +273,7 @@ public:
   #if HAS_DISPLAY
 
     static void init();
-    static void update();
+    static void update(const bool can_redraw=true);
     static void set_alert_status_P(PGM_P message);
 
     static char status_message[];
@@ -391,7 +391,7 @@ public:
   #else // No LCD
 
     static inline void init() {}
-    static inline void update() {}
+    static inline void update(const bool=true) {}
     static inline void refresh() {}
     static inline void return_to_status() {}
     static inline void set_alert_status_P(PGM_P message) { UNUSED(message); }
@@ -40,6 +40,7 @@ L6470_Marlin L6470;
 #include "../../core/debug_out.h"
 
 uint8_t L6470_Marlin::dir_commands[MAX_L6470];  // array to hold direction command for each driver
+bool L6470_Marlin::dir_refresh = true;
 
 char L6470_Marlin::index_to_axis[MAX_L6470][3] = { "X ", "Y ", "Z ", "X2", "Y2", "Z2", "Z3", "E0", "E1", "E2", "E3", "E4", "E5" };
 
@@ -131,6 +132,37 @@ void L6470_Marlin::populate_chain_array() {
   #endif
 }
 
+/**
+ * Send the direction commands to the whole chain in one transaction, but only
+ * if a chip's command changed since the last one sent. The step clock command
+ * also takes a chip out of HiZ, so dir_refresh forces all to be sent.
+ */
+void L6470_Marlin::send_dir_commands() {
+  static uint8_t dir_sent[MAX_L6470 + 1];   // Chain-ordered commands last sent - element 0 not used
+  uint8_t L6470_buf[MAX_L6470 + 1];         // chip command sequence - element 0 not used
+  const uint8_t length = L6470::chain[0];
+
+  bool changed = dir_refresh;
+  for (uint8_t j = 1; j <= length; j++) {
+    L6470_buf[j] = dir_commands[L6470::chain[j]];
+    if (L6470_buf[j] != dir_sent[j]) changed = true;
+  }
+  if (!changed) return;
+
+  if (spi_active) {
+    spi_abort = true;                       // interrupted a SPI transfer - need to shut it down gracefully
+    uint8_t nop_buf[MAX_L6470 + 1];
+    for (uint8_t n = 3; n--;) {             // send enough NOOPs to complete any command
+      for (uint8_t j = 1; j <= length; j++) nop_buf[j] = dSPIN_NOP;
+      transfer(nop_buf, length);
+    }
+  }
+
+  for (uint8_t j = 1; j <= length; j++) dir_sent[j] = L6470_buf[j];
+  transfer(L6470_buf, length);              // send the command stream to the drivers
+  dir_refresh = false;
+}
+
 void L6470_Marlin::init() {               // Set up SPI and then init chips
   #if PIN_EXISTS(L6470_RESET_CHAIN)
     OUT_WRITE(L6470_RESET_CHAIN_PIN, LOW);  // hardware reset of drivers
@@ -670,6 +702,7 @@ void L6470_Marlin::error_status_decode(const uint16_t status, const uint8_t axis
 
           if (status & STATUS_HIZ) {                         // the driver has shut down  HiZ is active high
             driver_L6470_data[j].is_hi_Z = true;
+            dir_refresh = true;                              // re-enable with the next block
             p += sprintf_P(p, PSTR("%cIS SHUT DOWN"), ' ');
             //         if (_status & STATUS_TH_SD) {                     // strange - TH_SD never seems to go active, must be implied by the HiZ and TH_WRN
             if (_status & STATUS_TH_WRN) {                    // over current shutdown
@@ -733,8 +766,6 @@ void L6470_Marlin::error_status_decode(const uint16_t status, const uint8_t axis
     } // comms re-established
   } // end L6470_monitor_update()
 
-  #define MONITOR_L6470_DRIVE(Q) L6470_monitor_update(Q, stepper##Q.getStatus())
-
   void L6470_Marlin::monitor_driver() {
     static millis_t next_cOT = 0;
     if (ELAPSED(millis(), next_cOT)) {
@@ -742,45 +773,12 @@ void L6470_Marlin::error_status_decode(const uint16_t status, const uint8_t axis
 
       spi_active = true;    // let set_directions() know we're in the middle of a series of SPI transfers
 
-      #if AXIS_DRIVER_TYPE_X(L6470)
-        MONITOR_L6470_DRIVE(X);
-      #endif
-      #if AXIS_DRIVER_TYPE_Y(L6470)
-        MONITOR_L6470_DRIVE(Y);
-      #endif
-      #if AXIS_DRIVER_TYPE_Z(L6470)
-        MONITOR_L6470_DRIVE(Z);
-      #endif
-      #if AXIS_DRIVER_TYPE_X2(L6470)
-        MONITOR_L6470_DRIVE(X2);
-      #endif
-      #if AXIS_DRIVER_TYPE_Y2(L6470)
-        MONITOR_L6470_DRIVE(Y2);
-      #endif
-      #if AXIS_DRIVER_TYPE_Z2(L6470)
-        MONITOR_L6470_DRIVE(Z2);
-      #endif
-      #if AXIS_DRIVER_TYPE_Z3(L6470)
-        MONITOR_L6470_DRIVE(Z3);
-      #endif
-      #if AXIS_DRIVER_TYPE_E0(L6470)
-        MONITOR_L6470_DRIVE(E0);
-      #endif
-      #if AXIS_DRIVER_TYPE_E1(L6470)
-        MONITOR_L6470_DRIVE(E1);
-      #endif
-      #if AXIS_DRIVER_TYPE_E2(L6470)
-        MONITOR_L6470_DRIVE(E2);
-      #endif
-      #if AXIS_DRIVER_TYPE_E3(L6470)
-        MONITOR_L6470_DRIVE(E3);
-      #endif
-      #if AXIS_DRIVER_TYPE_E4(L6470)
-        MONITOR_L6470_DRIVE(E4);
-      #endif
-      #if AXIS_DRIVER_TYPE_E5(L6470)
-        MONITOR_L6470_DRIVE(E5);
-      #endif
+      // Read the status of every chip at once. Drop the sample if a direction change cut in.
+      const uint8_t length = L6470::chain[0];
+      uint16_t status[MAX_L6470 + 1];
+      if (L6470_get_chain_status(status, length))
+        for (uint8_t j = 1; j <= length; j++)
+          L6470_monitor_update(L6470::chain[j], status[j]);
 
       #if ENABLED(L6470_DEBUG)
         if (report_L6470_status) L6470_EOL();
@@ -33,12 +33,16 @@ enum L6470_driver_enum : unsigned char { X, Y, Z, X2, Y2, Z2, Z3, E0, E1, E2, E3
 #define dSPIN_STEP_CLOCK_FWD dSPIN_STEP_CLOCK
 #define dSPIN_STEP_CLOCK_REV dSPIN_STEP_CLOCK+1
 
+void L6470_transfer(uint8_t L6470_buf[], const uint8_t length);
+bool L6470_get_chain_status(uint16_t status[], const uint8_t length);
+
 class L6470_Marlin {
 public:
   static bool index_to_dir[MAX_L6470];
   static uint8_t axis_xref[MAX_L6470];
   static char index_to_axis[MAX_L6470][3];
   static uint8_t dir_commands[MAX_L6470];
+  static bool dir_refresh;  // Resend all direction commands, e.g., after the chips were put in HiZ
 
   // Flags to guarantee graceful switch if stepper interrupts L6470 SPI transfer
   static volatile bool spi_abort;
@@ -46,6 +50,12 @@ public:
 
   L6470_Marlin() {}
 
+  // Exchange one byte with every chip in the chain. Each reply replaces the byte sent.
+  static inline void transfer(uint8_t L6470_buf[], const uint8_t length) { L6470_transfer(L6470_buf, length); }
+
+  // Called by the stepper ISR at the start of a block with new directions
+  static void send_dir_commands();
+
   static uint16_t get_status(const uint8_t axis);
 
   static uint32_t get_param(uint8_t axis, uint8_t param);
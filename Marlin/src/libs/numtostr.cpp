@@ -294,3 +294,38 @@ char* ftostr52sp(const float &f) {
   }
   return conv;
 }
+
+// Write the digits of an unsigned int, using 16-bit math when it fits
+static char* uitostrbuf(char *buf, uint32_t i) {
+  char tmp[10], *p = tmp;
+  while (i > 0xFFFF) { *p++ = DIGIT(i % 10); i /= 10; }
+  uint16_t ii = i;
+  do { *p++ = DIGIT(ii % 10); ii /= 10; } while (ii);
+  while (p > tmp) *buf++ = *--p;
+  return buf;
+}
+
+// Convert signed float to string with 1.23 / -123.45678 format into a caller buffer.
+// The float is split into integer and fraction parts and each is scaled once,
+// so no rounding error accumulates and the digits come from integer math.
+char* ftostrfix(char *buf, const float &f, uint8_t digits/*=2*/) {
+  float a = f;
+  if (a != a) { buf[0] = 'n'; buf[1] = 'a'; buf[2] = 'n'; buf[3] = '\0'; return buf + 3; }
+  if (a < 0) { *buf++ = '-'; a = -a; }
+  if (a >= 4294967040.0f) { buf[0] = 'o'; buf[1] = 'v'; buf[2] = 'f'; buf[3] = '\0'; return buf + 3; } // Includes inf
+  NOMORE(digits, FTOSTRFIX_MAX_DIGITS);
+
+  uint32_t scale = 1;
+  for (uint8_t d = digits; d--;) scale *= 10;
+
+  uint32_t ip = uint32_t(a), fp = uint32_t((a - ip) * scale + 0.5f);
+  if (fp >= scale) { ip++; fp -= scale; }   // Rounded up to the next integer
+
+  buf = uitostrbuf(buf, ip);
+  if (digits) {
+    *buf++ = '.';
+    for (char *p = (buf += digits); p-- > buf - digits;) { *p = DIGIT(fp % 10); fp /= 10; }
+  }
+  *buf = '\0';
+  return buf;
+}
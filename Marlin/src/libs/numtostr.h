@@ -83,6 +83,14 @@ char* ftostr52sign(const float &x);
 // Convert unsigned float to string with 1234.5 format omitting trailing zeros
 char* ftostr51rj(const float &x);
 
+// Convert signed float to string with 1.23 / -123.45678 format into a caller buffer
+// of FTOSTRFIX_SIZE(digits). Return a pointer to the terminating nul.
+// For serial output. The fixed-width LCD conversions above pad and cut to their
+// field instead, and already scale once and take the digits with integer math.
+#define FTOSTRFIX_MAX_DIGITS 9
+#define FTOSTRFIX_SIZE(D) (13 + (D))
+char* ftostrfix(char *buf, const float &x, uint8_t digits=2);
+
 #include "../core/macros.h"
 
 // Convert float to rj string with 123 or -12 format
@@ -341,10 +341,12 @@ void _internal_move_to_destination(const feedRate_t &fr_mm_s/*=0.0f*/
 }
 
 /**
- * Plan a move to (X, Y, Z) and set the current_position
+ * Plan a move to (X, Y, Z) and set the current_position.
+ * Z is raised before, or lowered after, the XY move.
+ * Returns without waiting for the move to finish.
  */
-void do_blocking_move_to(const float rx, const float ry, const float rz, const feedRate_t &fr_mm_s/*=0.0*/) {
-  if (DEBUGGING(LEVELING)) DEBUG_XYZ(">>> do_blocking_move_to", rx, ry, rz);
+void do_move_to(const float rx, const float ry, const float rz, const feedRate_t &fr_mm_s/*=0.0*/) {
+  if (DEBUGGING(LEVELING)) DEBUG_XYZ(">>> do_move_to", rx, ry, rz);
 
   const feedRate_t z_feedrate = fr_mm_s ? fr_mm_s : homing_feedrate(Z_AXIS),
                   xy_feedrate = fr_mm_s ? fr_mm_s : feedRate_t(XY_PROBE_FEEDRATE_MM_S);
@@ -433,8 +435,14 @@ void do_blocking_move_to(const float rx, const float ry, const float rz, const f
 
   #endif
 
-  if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("<<< do_blocking_move_to");
+  if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("<<< do_move_to");
+}
 
+/**
+ * Plan a move to (X, Y, Z), set the current_position, and wait for it to finish
+ */
+void do_blocking_move_to(const float rx, const float ry, const float rz, const feedRate_t &fr_mm_s/*=0.0*/) {
+  do_move_to(rx, ry, rz, fr_mm_s);
   planner.synchronize();
 }
 void do_blocking_move_to_x(const float &rx, const feedRate_t &fr_mm_s/*=0.0*/) {
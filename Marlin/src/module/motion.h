@@ -193,6 +193,15 @@ inline void prepare_internal_move_to_destination(const feedRate_t &fr_mm_s=0.0f)
   }
 #endif
 
+/**
+ * Movement that doesn't wait for the planner
+ */
+void do_move_to(const float rx, const float ry, const float rz, const feedRate_t &fr_mm_s=0.0f);
+
+FORCE_INLINE void do_move_to(const float (&raw)[XYZE], const feedRate_t &fr_mm_s=0) {
+  do_move_to(raw[X_AXIS], raw[Y_AXIS], raw[Z_AXIS], fr_mm_s);
+}
+
 /**
  * Blocking movement and shorthand functions
  */
@@ -100,6 +100,14 @@
   #include "../feature/power_loss_recovery.h"
 #endif
 
+#if ENABLED(LASER_POWER_INLINE)
+  #include "../feature/spindle_laser.h"
+#endif
+
+#if ENABLED(INLINE_OUTPUT_EVENTS) && HAS_SERVOS
+  #include "servo.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -221,6 +229,18 @@ float Planner::previous_speed[NUM_AXIS],
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
+#if ENABLED(INLINE_OUTPUT_EVENTS)
+  output_event_t Planner::pending_output_events[INLINE_OUTPUT_EVENTS_PER_BLOCK];
+  volatile uint8_t Planner::pending_output_event_count; // = 0
+  #if FAN_COUNT > 0
+    uint8_t Planner::planned_fan_speed[FAN_COUNT], // = { 0 }
+            Planner::output_fan_speed[FAN_COUNT];  // = { 0 }
+  #endif
+  #if ENABLED(PHOTO_GCODE) && PIN_EXISTS(CHDK)
+    extern millis_t chdk_timeout;
+  #endif
+#endif
+
 /**
  * Class and Instance Methods
  */
@@ -860,7 +880,7 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
 
       const float new_entry_speed_sqr = TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH)
         ? max_entry_speed_sqr
-        : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current->acceleration, next ? next->entry_speed_sqr : sq(float(MINIMUM_PLANNER_SPEED)), current->millimeters));
+        : _MIN(max_entry_speed_sqr, (next ? next->entry_speed_sqr : sq(float(MINIMUM_PLANNER_SPEED))) + current->accel_speed_sqr);
       if (current->entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
@@ -945,7 +965,7 @@ void Planner::forward_pass_kernel(const block_t* const previous, block_t* const
       previous->entry_speed_sqr < current->entry_speed_sqr) {
 
       // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
+      const float new_entry_speed_sqr = previous->entry_speed_sqr + previous->accel_speed_sqr;
 
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (new_entry_speed_sqr < current->entry_speed_sqr) {
@@ -1081,9 +1101,8 @@ void Planner::recalculate_trapezoids() {
             calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
             #if ENABLED(LIN_ADVANCE)
               if (block->use_advance_lead) {
-                const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-                block->max_adv_steps = current_nominal_speed * comp;
-                block->final_adv_steps = next_entry_speed * comp;
+                block->max_adv_steps = current_nominal_speed * block->advance_factor;
+                block->final_adv_steps = next_entry_speed * block->advance_factor;
               }
             #endif
           }
@@ -1120,9 +1139,8 @@ void Planner::recalculate_trapezoids() {
       calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
       #if ENABLED(LIN_ADVANCE)
         if (next->use_advance_lead) {
-          const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-          next->max_adv_steps = next_nominal_speed * comp;
-          next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
+          next->max_adv_steps = next_nominal_speed * next->advance_factor;
+          next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * next->advance_factor;
         }
       #endif
     }
@@ -1179,7 +1197,7 @@ void Planner::check_axes_activity() {
     uint8_t axis_active[NUM_AXIS] = { 0 };
   #endif
 
-  #if FAN_COUNT > 0
+  #if FAN_COUNT > 0 && DISABLED(INLINE_OUTPUT_EVENTS)
     uint8_t tail_fan_speed[FAN_COUNT];
   #endif
 
@@ -1194,11 +1212,11 @@ void Planner::check_axes_activity() {
 
   if (has_blocks_queued()) {
 
-    #if FAN_COUNT > 0 || ENABLED(BARICUDA)
+    #if (FAN_COUNT > 0 && DISABLED(INLINE_OUTPUT_EVENTS)) || ENABLED(BARICUDA)
       block_t *block = &block_buffer[block_buffer_tail];
     #endif
 
-    #if FAN_COUNT > 0
+    #if FAN_COUNT > 0 && DISABLED(INLINE_OUTPUT_EVENTS)
       FANS_LOOP(i)
         tail_fan_speed[i] = thermalManager.scaledFanSpeed(i, block->fan_speed[i]);
     #endif
@@ -1221,8 +1239,13 @@ void Planner::check_axes_activity() {
   }
   else {
     #if FAN_COUNT > 0
-      FANS_LOOP(i)
-        tail_fan_speed[i] = thermalManager.scaledFanSpeed(i);
+      #if ENABLED(INLINE_OUTPUT_EVENTS)
+        // No moves to wait for. Fan changes take effect now.
+        FANS_LOOP(i) output_fan_speed[i] = planned_fan_speed[i] = thermalManager.fan_speed[i];
+      #else
+        FANS_LOOP(i)
+          tail_fan_speed[i] = thermalManager.scaledFanSpeed(i);
+      #endif
     #endif
 
     #if ENABLED(BARICUDA)
@@ -1249,62 +1272,166 @@ void Planner::check_axes_activity() {
   #endif
 
   #if FAN_COUNT > 0
+    #if ENABLED(INLINE_OUTPUT_EVENTS)
+      // Fan events also set the fans from the Stepper ISR
+      const bool was_enabled = STEPPER_ISR_ENABLED();
+      if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+      FANS_LOOP(i) apply_fan_speed(i, thermalManager.scaledFanSpeed(i, output_fan_speed[i]));
+      if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+    #else
+      FANS_LOOP(i) apply_fan_speed(i, tail_fan_speed[i]);
+    #endif
+  #endif
+
+  #if ENABLED(AUTOTEMP)
+    getHighESpeed();
+  #endif
+
+  #if ENABLED(BARICUDA)
+    #if HAS_HEATER_1
+      analogWrite(pin_t(HEATER_1_PIN), tail_valve_pressure);
+    #endif
+    #if HAS_HEATER_2
+      analogWrite(pin_t(HEATER_2_PIN), tail_e_to_p_pressure);
+    #endif
+  #endif
+}
+
+#if FAN_COUNT > 0
+
+  /**
+   * Set a fan output to a scaled speed, kickstarting it from a stop
+   */
+  void Planner::apply_fan_speed(const uint8_t f, uint8_t speed) {
 
     #if FAN_KICKSTART_TIME > 0
       static millis_t fan_kick_end[FAN_COUNT] = { 0 };
-      #define KICKSTART_FAN(f)                         \
-        if (tail_fan_speed[f]) {                       \
-          millis_t ms = millis();                      \
-          if (fan_kick_end[f] == 0) {                  \
-            fan_kick_end[f] = ms + FAN_KICKSTART_TIME; \
-            tail_fan_speed[f] = 255;                   \
-          } else if (PENDING(ms, fan_kick_end[f]))     \
-            tail_fan_speed[f] = 255;                   \
-        } else fan_kick_end[f] = 0
-    #else
-      #define KICKSTART_FAN(f) NOOP
+      if (speed) {
+        const millis_t ms = millis();
+        if (fan_kick_end[f] == 0) {
+          fan_kick_end[f] = ms + FAN_KICKSTART_TIME;
+          speed = 255;
+        }
+        else if (PENDING(ms, fan_kick_end[f]))
+          speed = 255;
+      }
+      else
+        fan_kick_end[f] = 0;
     #endif
 
     #if FAN_MIN_PWM != 0 || FAN_MAX_PWM != 255
-      #define CALC_FAN_SPEED(f) (tail_fan_speed[f] ? map(tail_fan_speed[f], 1, 255, FAN_MIN_PWM, FAN_MAX_PWM) : 0)
-    #else
-      #define CALC_FAN_SPEED(f) tail_fan_speed[f]
+      if (speed) speed = map(speed, 1, 255, FAN_MIN_PWM, FAN_MAX_PWM);
     #endif
 
     #if ENABLED(FAN_SOFT_PWM)
-      #define _FAN_SET(F) thermalManager.soft_pwm_amount_fan[F] = CALC_FAN_SPEED(F);
+      #define _FAN_SET(F) thermalManager.soft_pwm_amount_fan[F] = speed
     #elif ENABLED(FAST_PWM_FAN)
-      #define _FAN_SET(F) set_pwm_duty(FAN##F##_PIN, CALC_FAN_SPEED(F));
+      #define _FAN_SET(F) set_pwm_duty(FAN##F##_PIN, speed)
     #else
-      #define _FAN_SET(F) analogWrite(pin_t(FAN##F##_PIN), CALC_FAN_SPEED(F));
+      #define _FAN_SET(F) analogWrite(pin_t(FAN##F##_PIN), speed)
     #endif
-    #define FAN_SET(F) do{ KICKSTART_FAN(F); _FAN_SET(F); }while(0)
 
-    #if HAS_FAN0
-      FAN_SET(0);
-    #endif
-    #if HAS_FAN1
-      FAN_SET(1);
-    #endif
-    #if HAS_FAN2
-      FAN_SET(2);
-    #endif
+    switch (f) {
+      #if HAS_FAN0
+        case 0: _FAN_SET(0); break;
+      #endif
+      #if HAS_FAN1
+        case 1: _FAN_SET(1); break;
+      #endif
+      #if HAS_FAN2
+        case 2: _FAN_SET(2); break;
+      #endif
+    }
+  }
 
-  #endif // FAN_COUNT > 0
+#endif // FAN_COUNT > 0
 
-  #if ENABLED(AUTOTEMP)
-    getHighESpeed();
-  #endif
+#if ENABLED(INLINE_OUTPUT_EVENTS)
 
-  #if ENABLED(BARICUDA)
-    #if HAS_HEATER_1
-      analogWrite(pin_t(HEATER_1_PIN), tail_valve_pressure);
-    #endif
-    #if HAS_HEATER_2
-      analogWrite(pin_t(HEATER_2_PIN), tail_e_to_p_pressure);
+  /**
+   * Change an output as the next planned move starts. With no moves
+   * in the planner there is nothing to wait for, so change it now.
+   */
+  void Planner::queue_output_event(const OutputEventType type, const pin_t index, const uint8_t value) {
+    const output_event_t ev = { index, type, value };
+
+    // With no room left, let the queued moves finish
+    if (pending_output_event_count >= INLINE_OUTPUT_EVENTS_PER_BLOCK) synchronize();
+
+    // The Stepper ISR flushes the events when it runs out of moves
+    const bool was_enabled = STEPPER_ISR_ENABLED();
+    if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+    const bool queued = has_blocks_queued();
+    if (queued) pending_output_events[pending_output_event_count++] = ev;
+    if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+
+    if (!queued) apply_output_event(ev);
+  }
+
+  /**
+   * Move the waiting output events, and any fan changes, into a new block
+   */
+  void Planner::attach_output_events(block_t * const block) {
+    const bool was_enabled = STEPPER_ISR_ENABLED();
+    if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+    uint8_t n = pending_output_event_count;
+    for (uint8_t i = 0; i < n; i++) block->output_events[i] = pending_output_events[i];
+    pending_output_event_count = 0;
+    if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+
+    #if FAN_COUNT > 0
+      // Fans left over for lack of room go with the next move
+      FANS_LOOP(i) if (n < INLINE_OUTPUT_EVENTS_PER_BLOCK && planned_fan_speed[i] != thermalManager.fan_speed[i]) {
+        output_event_t &ev = block->output_events[n++];
+        ev.index = i;
+        ev.type = OUTPUT_EVENT_FAN;
+        ev.value = planned_fan_speed[i] = thermalManager.fan_speed[i];
+      }
     #endif
-  #endif
-}
+
+    block->output_event_count = n;
+  }
+
+  /**
+   * Out of moves. Apply the waiting output events, as if they were issued now.
+   */
+  void Planner::flush_output_events() {
+    for (uint8_t i = 0; i < pending_output_event_count; i++) apply_output_event(pending_output_events[i]);
+    pending_output_event_count = 0;
+  }
+
+  void Planner::apply_output_event(const output_event_t &ev) {
+    switch (ev.type) {
+      case OUTPUT_EVENT_PIN:
+        pinMode(ev.index, OUTPUT);
+        extDigitalWrite(ev.index, ev.value);
+        analogWrite(ev.index, ev.value);
+        break;
+      case OUTPUT_EVENT_DIGITAL:
+        extDigitalWrite(ev.index, ev.value);
+        break;
+      #if FAN_COUNT > 0
+        case OUTPUT_EVENT_FAN:
+          output_fan_speed[ev.index] = ev.value;
+          apply_fan_speed(ev.index, thermalManager.scaledFanSpeed(ev.index, ev.value));
+          break;
+      #endif
+      #if HAS_SERVOS
+        case OUTPUT_EVENT_SERVO:
+          servo[ev.index].write(ev.value);
+          break;
+      #endif
+      #if ENABLED(PHOTO_GCODE) && PIN_EXISTS(CHDK)
+        case OUTPUT_EVENT_CAMERA:
+          OUT_WRITE(CHDK_PIN, HIGH);
+          chdk_timeout = millis() + PHOTO_SWITCH_MS;
+          break;
+      #endif
+      default: break;
+    }
+  }
+
+#endif // INLINE_OUTPUT_EVENTS
 
 #if DISABLED(NO_VOLUMETRICS)
 
@@ -1471,9 +1598,23 @@ void Planner::quick_stop() {
   const bool was_enabled = STEPPER_ISR_ENABLED();
   if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
 
+  #if ENABLED(INLINE_OUTPUT_EVENTS)
+    // Output changes for the dropped moves were already processed, so apply
+    // them now along with those waiting for the next move. (e.g., M9 or
+    // M107 before M410.) Blocks up to block_buffer_nonbusy already did.
+    for (uint8_t b = block_buffer_nonbusy; b != block_buffer_head; b = next_block_index(b))
+      apply_output_events(&block_buffer[b]);
+    flush_output_events();
+  #endif
+
   // Drop all queue entries
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
 
+  #if ENABLED(LASER_POWER_INLINE)
+    // Stop the cutter with the moves. The stepper applies this as it drops the current block.
+    cutter.set_inline_power(0);
+  #endif
+
   // Restart the block delay for the first movement - As the queue was
   // forced to empty, there's no risk the ISR will touch this.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
@@ -1801,8 +1942,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     delta_mm[E_AXIS] = esteps_float * steps_to_mm[E_AXIS_N(extruder)];
   #endif
 
+  // The length of the move in mm. Only needed while populating the block.
+  float move_mm;
+
   if (block->steps[A_AXIS] < MIN_STEPS_PER_SEGMENT && block->steps[B_AXIS] < MIN_STEPS_PER_SEGMENT && block->steps[C_AXIS] < MIN_STEPS_PER_SEGMENT) {
-    block->millimeters = (0
+    move_mm = (0
       #if EXTRUDERS
         + ABS(delta_mm[E_AXIS])
       #endif
@@ -1810,9 +1954,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   }
   else {
     if (millimeters)
-      block->millimeters = millimeters;
+      move_mm = millimeters;
     else
-      block->millimeters = SQRT(
+      move_mm = SQRT(
         #if CORE_IS_XY
           sq(delta_mm[X_HEAD]) + sq(delta_mm[Y_HEAD]) + sq(delta_mm[Z_AXIS])
         #elif CORE_IS_XZ
@@ -1834,7 +1978,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
      * should *never* remove steps!
      */
     #if ENABLED(BACKLASH_COMPENSATION)
-      backlash.add_correction_steps(da, db, dc, dm, block);
+      backlash.add_correction_steps(da, db, dc, dm, move_mm, block);
     #endif
   }
 
@@ -1851,10 +1995,17 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     MIXER_POPULATE_BLOCK();
   #endif
 
-  #if FAN_COUNT > 0
+  #if ENABLED(INLINE_OUTPUT_EVENTS)
+    attach_output_events(block);
+  #elif FAN_COUNT > 0
     FANS_LOOP(i) block->fan_speed[i] = thermalManager.fan_speed[i];
   #endif
 
+  #if ENABLED(LASER_POWER_INLINE)
+    block->cutter_enabled = cutter.inline_enabled;
+    block->cutter_ocr = cutter.inline_ocr;
+  #endif
+
   #if ENABLED(BARICUDA)
     block->valve_pressure = baricuda_valve_pressure;
     block->e_to_p_pressure = baricuda_e_to_p_pressure;
@@ -2030,7 +2181,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   else
     NOLESS(fr_mm_s, settings.min_travel_feedrate_mm_s);
 
-  const float inverse_millimeters = 1.0f / block->millimeters;  // Inverse millimeters to remove multiple divides
+  const float inverse_millimeters = 1.0f / move_mm;  // Inverse millimeters to remove multiple divides
 
   // Calculate inverse time for this move. No divide by zero due to previous checks.
   // Example: At 120mm/s a 60mm move takes 0.5s. So this will give 2.0.
@@ -2069,7 +2220,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
   #endif
 
-  block->nominal_speed_sqr = sq(block->millimeters * inverse_secs);   //   (mm/sec)^2 Always > 0
+  block->nominal_speed_sqr = sq(move_mm * inverse_secs);   //   (mm/sec)^2 Always > 0
   block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
 
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -2143,6 +2294,13 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
   }
 
+  #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+    // Let the stepper scale the cutter power with the step rate along the trapezoid.
+    // Round up so the full power is reached at nominal_rate.
+    const uint32_t nominal_rate = _MAX(block->nominal_rate, 1UL);
+    block->cutter_ocr_per_rate = ((uint32_t(block->cutter_ocr) << (CUTTER_OCR_RATE_BITS)) + nominal_rate - 1) / nominal_rate;
+  #endif
+
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
   uint32_t accel;
@@ -2189,18 +2347,21 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
        *
        * esteps             : This is a print move, because we checked for A, B, C steps before.
        *
-       * extruder_advance_K[active_extruder] : There is an advance factor set for this extruder.
+       * extruder_advance_K[extruder] : There is an advance factor set for this extruder.
        *
        * de > 0             : Extruder is running forward (e.g., for "Wipe while retracting" (Slic3r) or "Combing" (Cura) moves)
+       *
+       * The K factor is captured in the block, so M900 takes effect in order with the moves.
        */
+      const float advance_K = extruder_advance_K[extruder];
       block->use_advance_lead =  esteps
-                              && extruder_advance_K[active_extruder]
+                              && advance_K
                               && de > 0;
 
       if (block->use_advance_lead) {
-        block->e_D_ratio = (target_float[E_AXIS] - position_float[E_AXIS]) /
+        const float e_D_ratio = (target_float[E_AXIS] - position_float[E_AXIS]) /
           #if IS_KINEMATIC
-            block->millimeters
+            move_mm
           #else
             SQRT(sq(target_float[X_AXIS] - position_float[X_AXIS])
                + sq(target_float[Y_AXIS] - position_float[Y_AXIS])
@@ -2210,10 +2371,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
         // Check for unusual high e_D ratio to detect if a retract move was combined with the last print move due to min. steps per segment. Never execute this with advance!
         // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
-        if (block->e_D_ratio > 3.0f)
+        if (e_D_ratio > 3.0f)
           block->use_advance_lead = false;
         else {
-          const uint32_t max_accel_steps_per_s2 = MAX_E_JERK / (extruder_advance_K[active_extruder] * block->e_D_ratio) * steps_per_mm;
+          block->advance_factor = e_D_ratio * advance_K * settings.axis_steps_per_mm[E_AXIS_N(extruder)];
+          const uint32_t max_accel_steps_per_s2 = MAX_E_JERK / (advance_K * e_D_ratio) * steps_per_mm;
           #if ENABLED(LA_DEBUG)
             if (accel > max_accel_steps_per_s2) SERIAL_ECHOLNPGM("Acceleration limited.");
           #endif
@@ -2243,15 +2405,16 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     }
   }
   block->acceleration_steps_per_s2 = accel;
-  block->acceleration = accel / steps_per_mm;
+  const float acceleration = accel / steps_per_mm;     // (mm/sec^2)
+  block->accel_speed_sqr = 2 * acceleration * move_mm;
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = (uint32_t)(accel * (4096.0f * 4096.0f / (STEPPER_TIMER_RATE)));
   #endif
   #if ENABLED(LIN_ADVANCE)
     if (block->use_advance_lead) {
-      block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
+      block->advance_speed = (STEPPER_TIMER_RATE) / (block->advance_factor * acceleration);
       #if ENABLED(LA_DEBUG)
-        if (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * 2 < SQRT(block->nominal_speed_sqr) * block->e_D_ratio)
+        if (extruder_advance_K[extruder] * acceleration * 2 < SQRT(block->nominal_speed_sqr))
           SERIAL_ECHOLNPGM("More than 2 steps per eISR loop executed.");
         if (block->advance_speed < 200)
           SERIAL_ECHOLNPGM("eISR running at > 10kHz.");
@@ -2351,18 +2514,18 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
         };
         normalize_junction_vector(junction_unit_vec);
 
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec),
+        const float junction_acceleration = limit_value_by_axis_maximum(acceleration, junction_unit_vec),
                     sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
 
         vmax_junction_sqr = (junction_acceleration * junction_deviation_mm * sin_theta_d2) / (1.0f - sin_theta_d2);
-        if (block->millimeters < 1) {
+        if (move_mm < 1) {
 
           // Fast acos approximation, minus the error bar to be safe
           const float junction_theta = (RADIANS(-40) * sq(junction_cos_theta) - RADIANS(50)) * junction_cos_theta + RADIANS(90) - 0.18f;
 
           // If angle is greater than 135 degrees (octagon), find speed for approximate arc
           if (junction_theta > RADIANS(135)) {
-            const float limit_sqr = block->millimeters / (RADIANS(180) - junction_theta) * junction_acceleration;
+            const float limit_sqr = move_mm / (RADIANS(180) - junction_theta) * junction_acceleration;
             NOMORE(vmax_junction_sqr, limit_sqr);
           }
         }
@@ -2480,7 +2643,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   block->max_entry_speed_sqr = vmax_junction_sqr;
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
+  const float v_allowable_sqr = sq(float(MINIMUM_PLANNER_SPEED)) + block->accel_speed_sqr;
 
   // If we are trying to add a split block, start with the
   // max. allowed speed to avoid an interrupted first move.
@@ -2523,7 +2686,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
  * Planner::buffer_sync_block
  * Add a block to the buffer that just updates the position
  */
-void Planner::buffer_sync_block() {
+void Planner::buffer_sync_block(const uint8_t sync_flag/*=BLOCK_FLAG_SYNC_POSITION*/) {
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -2531,13 +2694,18 @@ void Planner::buffer_sync_block() {
   // Clear block
   memset(block, 0, sizeof(block_t));
 
-  block->flag = BLOCK_FLAG_SYNC_POSITION;
+  block->flag = sync_flag;
 
   block->position[A_AXIS] = position[A_AXIS];
   block->position[B_AXIS] = position[B_AXIS];
   block->position[C_AXIS] = position[C_AXIS];
   block->position[E_AXIS] = position[E_AXIS];
 
+  #if ENABLED(INLINE_OUTPUT_EVENTS)
+    // Keep output changes in order with sync blocks too
+    attach_output_events(block);
+  #endif
+
   // If this is the first added movement, reload the delay, otherwise, cancel it.
   if (block_buffer_head == block_buffer_tail) {
     // If it was the first queued block, restart the 1st block delivery delay, to
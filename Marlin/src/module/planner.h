@@ -64,16 +64,47 @@ enum BlockFlagBit : char {
   BLOCK_BIT_CONTINUED,
 
   // Sync the stepper counts from the block
-  BLOCK_BIT_SYNC_POSITION
+  BLOCK_BIT_SYNC_POSITION,
+
+  // Hold the stepper at this block until it's released
+  BLOCK_BIT_HOLD
 };
 
 enum BlockFlag : char {
   BLOCK_FLAG_RECALCULATE          = _BV(BLOCK_BIT_RECALCULATE),
   BLOCK_FLAG_NOMINAL_LENGTH       = _BV(BLOCK_BIT_NOMINAL_LENGTH),
   BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED),
-  BLOCK_FLAG_SYNC_POSITION        = _BV(BLOCK_BIT_SYNC_POSITION)
+  BLOCK_FLAG_SYNC_POSITION        = _BV(BLOCK_BIT_SYNC_POSITION),
+  BLOCK_FLAG_HOLD                 = _BV(BLOCK_BIT_HOLD)
 };
 
+#if ENABLED(INLINE_OUTPUT_EVENTS)
+
+  /**
+   * An output change that waits for the next planned move to start
+   */
+  enum OutputEventType : uint8_t {
+    OUTPUT_EVENT_PIN,                       // M42 - Set a pin mode, level and PWM
+    OUTPUT_EVENT_DIGITAL,                   // M7 / M8 / M9 - Set a digital pin level
+    OUTPUT_EVENT_FAN,                       // Fan speed, as planned with a move
+    OUTPUT_EVENT_SERVO,                     // M280 - Move a servo
+    OUTPUT_EVENT_CAMERA                     // M240 - Press the CHDK shutter
+  };
+
+  typedef struct {
+    pin_t index;                            // Pin, fan or servo index
+    OutputEventType type;
+    uint8_t value;                          // Pin level / PWM, fan speed or servo angle
+  } output_event_t;
+
+#endif
+
+#if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+  // Fraction bits of cutter_ocr_per_rate. A PWM value up to 255 times a step
+  // rate up to nominal_rate still fits in 32 bits.
+  #define CUTTER_OCR_RATE_BITS 24
+#endif
+
 /**
  * struct block_t
  *
@@ -82,18 +113,31 @@ enum BlockFlag : char {
  *
  * The "nominal" values are as-specified by gcode, and
  * may never actually be reached due to acceleration limits.
+ *
+ * Fields are grouped by the code that reads them (planner lookahead, then the
+ * Stepper ISR) and ordered from widest to narrowest, so 32-bit targets don't
+ * pad between members. Every byte here is multiplied by BLOCK_BUFFER_SIZE, so
+ * anything only needed while the block is being populated stays out of it.
  */
 typedef struct block_t {
 
-  volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
-
   // Fields used by the motion planner to manage acceleration
   float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
         entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
         max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
+        accel_speed_sqr;                    // Speed change over the whole block at full acceleration, 2*a*d, in (mm/sec)^2
+
+  uint32_t acceleration_steps_per_s2;       // acceleration steps/sec^2
 
+  #if ENABLED(LIN_ADVANCE)
+    float advance_factor;                   // Advance steps per mm/s, from e/D ratio and the K in effect when queued
+  #endif
+
+  #if HAS_SPI_LCD
+    uint32_t segment_time_us;
+  #endif
+
+  // Fields used by the Stepper ISR
   union {
     // Data used by all move blocks
     struct {
@@ -107,16 +151,6 @@ typedef struct block_t {
   };
   uint32_t step_event_count;                // The number of step events required to complete this block
 
-  #if EXTRUDERS > 1
-    uint8_t extruder;                       // The extruder to move (if E move)
-  #else
-    static constexpr uint8_t extruder = 0;
-  #endif
-
-  #if ENABLED(MIXING_EXTRUDER)
-    MIXER_BLOCK_FIELD;                      // Normalized color for the mixing steppers
-  #endif
-
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
            decelerate_after;                // The index of the step event on which to start decelerating
@@ -131,36 +165,61 @@ typedef struct block_t {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
+           initial_rate,                    // The jerk-adjusted step rate at start of block
+           final_rate;                      // The minimal rate at exit
+
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    uint32_t sdpos;
+  #endif
+
+  #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+    uint32_t cutter_ocr_per_rate;           // Cutter PWM value per step rate, 8.24 fixed point
+  #endif
 
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
     uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
              max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
              final_adv_steps;               // advance steps due to exit speed
-    float e_D_ratio;
   #endif
 
-  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
-           initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
+  #if ENABLED(MIXING_EXTRUDER)
+    MIXER_BLOCK_FIELD;                      // Normalized color for the mixing steppers
+  #endif
 
-  #if FAN_COUNT > 0
-    uint8_t fan_speed[FAN_COUNT];
+  #if ENABLED(INLINE_OUTPUT_EVENTS)
+    output_event_t output_events[INLINE_OUTPUT_EVENTS_PER_BLOCK]; // Output changes to apply when this block starts
   #endif
 
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
+  // Byte-sized fields last, so they pack together
+  volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
+
+  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+
+  #if EXTRUDERS > 1
+    uint8_t extruder;                       // The extruder to move (if E move)
+  #else
+    static constexpr uint8_t extruder = 0;
   #endif
 
-  #if HAS_SPI_LCD
-    uint32_t segment_time_us;
+  #if ENABLED(LIN_ADVANCE)
+    bool use_advance_lead;
   #endif
 
-  #if ENABLED(POWER_LOSS_RECOVERY)
-    uint32_t sdpos;
+  #if ENABLED(INLINE_OUTPUT_EVENTS)
+    uint8_t output_event_count;             // Number of output_events in use
+  #elif FAN_COUNT > 0
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(LASER_POWER_INLINE)
+    bool cutter_enabled;                    // Cutter state to apply when this block starts
+    uint8_t cutter_ocr;                     // Cutter PWM value at nominal speed
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
   #endif
 
 } block_t;
@@ -345,6 +404,21 @@ class Planner {
       volatile static uint32_t block_buffer_runtime_us; //Theoretical block buffer runtime in µs
     #endif
 
+    #if ENABLED(INLINE_OUTPUT_EVENTS)
+      // Output changes waiting for the next planned move
+      static output_event_t pending_output_events[INLINE_OUTPUT_EVENTS_PER_BLOCK];
+      static volatile uint8_t pending_output_event_count;
+      #if FAN_COUNT > 0
+        static uint8_t planned_fan_speed[FAN_COUNT],      // Fan speeds as of the last planned move
+                       output_fan_speed[FAN_COUNT];       // Fan speeds as of the running move
+      #endif
+      static void attach_output_events(block_t * const block);
+    #endif
+
+    #if FAN_COUNT > 0
+      static void apply_fan_speed(const uint8_t f, uint8_t speed);
+    #endif
+
   public:
 
     /**
@@ -375,6 +449,18 @@ class Planner {
     // Manage fans, paste pressure, etc.
     static void check_axes_activity();
 
+    #if ENABLED(INLINE_OUTPUT_EVENTS)
+      // Change an output when the next planned move starts, or now if there are no moves
+      static void queue_output_event(const OutputEventType type, const pin_t index, const uint8_t value);
+
+      // Called by the Stepper ISR as a block starts, and when it runs out of moves
+      static void apply_output_event(const output_event_t &ev);
+      FORCE_INLINE static void apply_output_events(const block_t * const block) {
+        for (uint8_t i = 0; i < block->output_event_count; i++) apply_output_event(block->output_events[i]);
+      }
+      static void flush_output_events();
+    #endif
+
     // Update multipliers based on new diameter measurements
     static void calculate_volumetric_multipliers();
 
@@ -615,7 +701,35 @@ class Planner {
      * Planner::buffer_sync_block
      * Add a block to the buffer that just updates the position
      */
-    static void buffer_sync_block();
+    static void buffer_sync_block(const uint8_t sync_flag=BLOCK_FLAG_SYNC_POSITION);
+
+    #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+
+      /**
+       * Planner::buffer_hold_block
+       * Add a sync block that stops the stepper until release_hold().
+       * Moves planned after it wait in the buffer.
+       */
+      FORCE_INLINE static void buffer_hold_block() { buffer_sync_block(BLOCK_FLAG_SYNC_POSITION | BLOCK_FLAG_HOLD); }
+
+      // Have all the blocks ahead of the hold block finished?
+      FORCE_INLINE static bool hold_reached() {
+        return has_blocks_queued() && TEST(block_buffer[block_buffer_tail].flag, BLOCK_BIT_HOLD);
+      }
+
+      // Is the hold block still in the buffer? Not after quick_stop() cleared it.
+      static inline bool hold_queued() {
+        for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b))
+          if (TEST(block_buffer[b].flag, BLOCK_BIT_HOLD)) return true;
+        return false;
+      }
+
+      // Let the stepper continue past the hold block
+      FORCE_INLINE static void release_hold() {
+        if (hold_reached()) CBI(block_buffer[block_buffer_tail].flag, BLOCK_BIT_HOLD);
+      }
+
+    #endif
 
   #if IS_KINEMATIC
     private:
@@ -784,6 +898,11 @@ class Planner {
         // No trapezoid calculated? Don't execute yet.
         if (TEST(block->flag, BLOCK_BIT_RECALCULATE)) return nullptr;
 
+        #if ENABLED(MMU2_PIPELINED_TOOLCHANGE)
+          // Held until release_hold()
+          if (TEST(block->flag, BLOCK_BIT_HOLD)) return nullptr;
+        #endif
+
         #if HAS_SPI_LCD
           block_buffer_runtime_us -= block->segment_time_us; // We can't be sure how long an active block will take, so don't count it.
         #endif
@@ -910,15 +1029,6 @@ class Planner {
       return (accel * 2 * distance - sq(initial_rate) + sq(final_rate)) / (accel * 4);
     }
 
-    /**
-     * Calculate the maximum allowable speed squared at this point, in order
-     * to reach 'target_velocity_sqr' using 'acceleration' within a given
-     * 'distance'.
-     */
-    static float max_allowable_speed_sqr(const float &accel, const float &target_velocity_sqr, const float &distance) {
-      return target_velocity_sqr - 2 * accel * distance;
-    }
-
     #if ENABLED(S_CURVE_ACCELERATION)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
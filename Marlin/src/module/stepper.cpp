@@ -125,6 +125,10 @@ Stepper stepper; // Singleton
   #include "../feature/power_loss_recovery.h"
 #endif
 
+#if ENABLED(LASER_POWER_INLINE)
+  #include "../feature/spindle_laser.h"
+#endif
+
 // public:
 
 #if HAS_EXTRA_ENDSTOPS || ENABLED(Z_STEPPER_AUTO_ALIGN)
@@ -218,6 +222,10 @@ int32_t Stepper::ticks_nominal = -1;
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
 #endif
 
+#if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+  uint8_t Stepper::cutter_ocr; // = 0
+#endif
+
 volatile int32_t Stepper::endstops_trigsteps[XYZ];
 
 volatile int32_t Stepper::count_position[NUM_AXIS] = { 0 };
@@ -354,10 +362,6 @@ void Stepper::wake_up() {
  */
 void Stepper::set_directions() {
 
-  #if HAS_DRIVER(L6470)
-    uint8_t L6470_buf[MAX_L6470 + 1];   // chip command sequence - element 0 not used
-  #endif
-
   #if MINIMUM_STEPPER_PRE_DIR_DELAY > 0
     DELAY_NS(MINIMUM_STEPPER_PRE_DIR_DELAY);
   #endif
@@ -409,24 +413,8 @@ void Stepper::set_directions() {
   #endif // !LIN_ADVANCE
 
   #if HAS_DRIVER(L6470)
-
-    if (L6470.spi_active) {
-      L6470.spi_abort = true;                     // interrupted a SPI transfer - need to shut it down gracefully
-      for (uint8_t j = 1; j <= L6470::chain[0]; j++)
-        L6470_buf[j] = dSPIN_NOP;                 // fill buffer with NOOP commands
-      L6470.transfer(L6470_buf, L6470::chain[0]);  // send enough NOOPs to complete any command
-      L6470.transfer(L6470_buf, L6470::chain[0]);
-      L6470.transfer(L6470_buf, L6470::chain[0]);
-    }
-
-    // The L6470.dir_commands[] array holds the direction command for each stepper
-
-    //scan command array and copy matches into L6470.transfer
-    for (uint8_t j = 1; j <= L6470::chain[0]; j++)
-      L6470_buf[j] = L6470.dir_commands[L6470::chain[j]];
-
-    L6470.transfer(L6470_buf, L6470::chain[0]);  // send the command stream to the drivers
-
+    // The direction commands go to the chain in one transaction, if any changed
+    L6470.send_dir_commands();
   #endif
 
   // A small delay may be needed after changing direction
@@ -1405,6 +1393,10 @@ void Stepper::stepper_pulse_phase_isr() {
       current_block = nullptr;
       planner.discard_current_block();
     }
+    #if ENABLED(LASER_POWER_INLINE)
+      // Don't leave the cutter at the power of the dropped move
+      if (!planner.has_blocks_queued()) cutter.apply_inline();
+    #endif
   }
 
   // If there is no current block, do nothing
@@ -1535,6 +1527,17 @@ void Stepper::stepper_pulse_phase_isr() {
 // properly schedules blocks from the planner. This is executed after creating
 // the step pulses, so it is not time critical, as pulses are already done.
 
+#if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+
+  // Scale the cutter power with the step rate, keeping the energy per mm constant
+  FORCE_INLINE void Stepper::update_cutter_ocr(const uint32_t step_rate) {
+    if (!current_block->cutter_enabled) return;
+    const uint8_t ocr = (_MIN(step_rate, current_block->nominal_rate) * current_block->cutter_ocr_per_rate) >> (CUTTER_OCR_RATE_BITS);
+    if (ocr != cutter_ocr) cutter.set_ocr(cutter_ocr = ocr);
+  }
+
+#endif
+
 uint32_t Stepper::stepper_block_phase_isr() {
 
   // If no queued movements, just wait 1ms for the next move
@@ -1551,6 +1554,15 @@ uint32_t Stepper::stepper_block_phase_isr() {
       axis_did_move = 0;
       current_block = nullptr;
       planner.discard_current_block();
+
+      #if ENABLED(LASER_POWER_INLINE)
+        // Out of moves. Apply the latest M3/M4/M5 power, as if it was issued now.
+        if (!planner.has_blocks_queued()) cutter.apply_inline();
+      #endif
+      #if ENABLED(INLINE_OUTPUT_EVENTS)
+        // Out of moves. Output changes waiting for a move can't wait any longer.
+        if (!planner.has_blocks_queued()) planner.flush_output_events();
+      #endif
     }
     else {
       // Step events not completed yet...
@@ -1575,6 +1587,10 @@ uint32_t Stepper::stepper_block_phase_isr() {
         interval = calc_timer_interval(acc_step_rate, oversampling_factor, &steps_per_isr);
         acceleration_time += interval;
 
+        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+          update_cutter_ocr(acc_step_rate);
+        #endif
+
         #if ENABLED(LIN_ADVANCE)
           if (LA_use_advance_lead) {
             // Fire ISR if final adv_rate is reached
@@ -1620,6 +1636,10 @@ uint32_t Stepper::stepper_block_phase_isr() {
         interval = calc_timer_interval(step_rate, oversampling_factor, &steps_per_isr);
         deceleration_time += interval;
 
+        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+          update_cutter_ocr(step_rate);
+        #endif
+
         #if ENABLED(LIN_ADVANCE)
           if (LA_use_advance_lead) {
             // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
@@ -1643,6 +1663,10 @@ uint32_t Stepper::stepper_block_phase_isr() {
         if (ticks_nominal < 0) {
           // step_rate to timer interval and loops for the nominal speed
           ticks_nominal = calc_timer_interval(current_block->nominal_rate, oversampling_factor, &steps_per_isr);
+
+          #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+            update_cutter_ocr(current_block->nominal_rate);
+          #endif
         }
 
         // The timer interval is just the nominal value for the nominal speed
@@ -1664,17 +1688,49 @@ uint32_t Stepper::stepper_block_phase_isr() {
           current_block->position[A_AXIS], current_block->position[B_AXIS],
           current_block->position[C_AXIS], current_block->position[E_AXIS]
         );
+        #if ENABLED(INLINE_OUTPUT_EVENTS)
+          planner.apply_output_events(current_block);
+        #endif
         planner.discard_current_block();
 
         // Try to get a new block
-        if (!(current_block = planner.get_current_block()))
+        if (!(current_block = planner.get_current_block())) {
+          #if ENABLED(LASER_POWER_INLINE)
+            // Only sync blocks were left. Apply the latest M3/M4/M5 power.
+            if (!planner.has_blocks_queued()) cutter.apply_inline();
+          #endif
+          #if ENABLED(INLINE_OUTPUT_EVENTS)
+            // Output changes queued behind the sync blocks can't wait any longer
+            if (!planner.has_blocks_queued()) planner.flush_output_events();
+          #endif
           return interval; // No more queued movements!
+        }
       }
 
       #if ENABLED(POWER_LOSS_RECOVERY)
         recovery.info.sdpos = current_block->sdpos;
       #endif
 
+      // Let the HAL see each block as it's taken, with its final trapezoid
+      #ifdef HAL_STEPPER_BLOCK_HOOK
+        HAL_STEPPER_BLOCK_HOOK(current_block);
+      #endif
+
+      #if ENABLED(LASER_POWER_INLINE)
+        #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+          // Start at the power for the entry speed
+          cutter_ocr = (_MIN(current_block->initial_rate, current_block->nominal_rate) * current_block->cutter_ocr_per_rate) >> (CUTTER_OCR_RATE_BITS);
+          cutter.apply_output(current_block->cutter_enabled, cutter_ocr);
+        #else
+          cutter.apply_output(current_block->cutter_enabled, current_block->cutter_ocr);
+        #endif
+      #endif
+
+      #if ENABLED(INLINE_OUTPUT_EVENTS)
+        // Change the outputs that were waiting for this move
+        planner.apply_output_events(current_block);
+      #endif
+
       // Flag all moving axes for proper endstop handling
 
       #if IS_CORE
@@ -1812,12 +1868,11 @@ uint32_t Stepper::stepper_block_phase_isr() {
 
       if (
         #if HAS_DRIVER(L6470)
-          true  // Always set direction for L6470 (This also enables the chips)
-        #else
-          current_block->direction_bits != last_direction_bits
-          #if DISABLED(MIXING_EXTRUDER)
-            || stepper_extruder != last_moved_extruder
-          #endif
+          L6470.dir_refresh ||  // The step clock command also enables the chips
+        #endif
+        current_block->direction_bits != last_direction_bits
+        #if DISABLED(MIXING_EXTRUDER)
+          || stepper_extruder != last_moved_extruder
         #endif
       ) {
         last_direction_bits = current_block->direction_bits;
@@ -317,6 +317,11 @@ class Stepper {
       static uint32_t acc_step_rate; // needed for deceleration start point
     #endif
 
+    #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+      static uint8_t cutter_ocr;     // Last cutter PWM value set along the trapezoid
+      static void update_cutter_ocr(const uint32_t step_rate);
+    #endif
+
     //
     // Exact steps at which an endstop was triggered
     //
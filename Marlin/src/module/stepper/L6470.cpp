@@ -138,6 +138,7 @@ void L6470_Marlin::init_to_defaults() {
   #if AXIS_DRIVER_TYPE_E5(L6470)
     _L6470_INIT_CHIP(E5);
   #endif
+  dir_refresh = true;   // The chips are in HiZ until they get a step clock command
 }
 
 #endif // L6470
@@ -30,7 +30,7 @@
 #include "../../libs/L6470/L6470_Marlin.h"
 
 // L6470 has STEP on normal pins, but DIR/ENABLE via SPI
-#define L6470_WRITE_DIR_COMMAND(STATE,Q) do{ L6470_dir_commands[Q] = (STATE ?  dSPIN_STEP_CLOCK_REV : dSPIN_STEP_CLOCK_FWD); }while(0)
+#define L6470_WRITE_DIR_COMMAND(STATE,Q) do{ L6470.dir_commands[Q] = (STATE ?  dSPIN_STEP_CLOCK_REV : dSPIN_STEP_CLOCK_FWD); }while(0)
 
 // X Stepper
 #if AXIS_DRIVER_TYPE_X(L6470)
@@ -279,6 +279,19 @@ volatile bool Temperature::temp_meas_ready = false;
   lpq_ptr_t Temperature::lpq_ptr = 0;
 #endif
 
+#if HOTENDS && ENABLED(PIDTEMP) && DISABLED(PID_OPENLOOP)
+  float Temperature::pid_iState[HOTENDS],     // = { 0 }
+        Temperature::pid_iState_max[HOTENDS], // = { 0 }
+        Temperature::pid_dState[HOTENDS],     // = { 0 }
+        Temperature::pid_dTerm[HOTENDS];      // = { 0 }
+#endif
+
+#if ENABLED(PID_PROFILE)
+  uint32_t Temperature::pid_cycles_last, // = 0
+           Temperature::pid_cycles_avg,  // = 0
+           Temperature::pid_cycles_max;  // = 0
+#endif
+
 #define TEMPDIR(N) ((HEATER_##N##_RAW_LO_TEMP) < (HEATER_##N##_RAW_HI_TEMP) ? 1 : -1)
 
 #if HOTENDS
@@ -811,57 +824,87 @@ void Temperature::min_temp_error(const heater_ind_t heater) {
   _temp_error(heater, PSTR(MSG_T_MINTEMP), TEMP_ERR_PSTR(MSG_ERR_MINTEMP, heater));
 }
 
+#if ENABLED(PIDTEMP)
+
+  /**
+   * Update the temp manager when PID values change
+   */
+  void Temperature::updatePID() {
+    #if HOTENDS && DISABLED(PID_OPENLOOP)
+      // Divide once here, not on every heater update
+      HOTEND_LOOP() pid_iState_max[e] = float(PID_MAX) / PID_PARAM(Ki, e) - float(MIN_POWER);
+    #endif
+    #if ENABLED(PID_EXTRUSION_SCALING)
+      last_e_position = 0;
+    #endif
+  }
+
+#endif
+
+#if ENABLED(PID_PROFILE)
+
+  void Temperature::report_pid_profile() {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR("PID cycles last:", pid_cycles_last, " avg:", pid_cycles_avg, " max:", pid_cycles_max);
+  }
+
+#endif
+
 #if HOTENDS
 
-  float Temperature::get_pid_output_hotend(const uint8_t e) {
-    #if HOTENDS == 1
-      #define _HOTEND_TEST true
+  /**
+   * Set the PWM of all hotends in one pass. Each stage is a loop over the
+   * per-field PID arrays, without a call or a struct stride per hotend.
+   */
+  void Temperature::update_hotend_power() {
+
+    #if ENABLED(PID_PROFILE)
+      // Count in CPU cycles, from the microsecond clock
+      const uint32_t start_us = micros();
+    #endif
+
+    #if HEATER_IDLE_HANDLER
+      #define _TIMED_OUT(E) hotend_idle[E].timed_out
     #else
-      #define _HOTEND_TEST (e == active_extruder)
+      #define _TIMED_OUT(E) false
     #endif
-    E_UNUSED();
-    const uint8_t ee = HOTEND_INDEX;
+
+    float celsius[HOTENDS], power[HOTENDS];
+    HOTEND_LOOP() celsius[e] = temp_hotend[e].celsius;
+
     #if ENABLED(PIDTEMP)
       #if DISABLED(PID_OPENLOOP)
-        static hotend_pid_t work_pid[HOTENDS];
-        static float temp_iState[HOTENDS] = { 0 },
-                     temp_dState[HOTENDS] = { 0 };
-        static bool pid_reset[HOTENDS] = { false };
-        const float pid_error = temp_hotend[ee].target - temp_hotend[ee].celsius;
-
-        float pid_output;
-
-        if (temp_hotend[ee].target == 0
-          || pid_error < -(PID_FUNCTIONAL_RANGE)
-          #if HEATER_IDLE_HANDLER
-            || hotend_idle[ee].timed_out
-          #endif
-        ) {
-          pid_output = 0;
-          pid_reset[ee] = true;
-        }
-        else if (pid_error > PID_FUNCTIONAL_RANGE) {
-          pid_output = BANG_MAX;
-          pid_reset[ee] = true;
+
+        float error[HOTENDS];
+        HOTEND_LOOP() error[e] = temp_hotend[e].target - celsius[e];
+
+        // The D term follows the temperature whether or not PID is in control
+        float d_input[HOTENDS];
+        HOTEND_LOOP() {
+          d_input[e] = pid_dState[e] - celsius[e];
+          pid_dState[e] = celsius[e];
         }
-        else {
-          if (pid_reset[ee]) {
-            temp_iState[ee] = 0.0;
-            work_pid[ee].Kd = 0.0;
-            pid_reset[ee] = false;
-          }
 
-          work_pid[ee].Kd = work_pid[ee].Kd + PID_K2 * (PID_PARAM(Kd, ee) * (temp_dState[ee] - temp_hotend[ee].celsius) - work_pid[ee].Kd);
-          const float max_power_over_i_gain = float(PID_MAX) / PID_PARAM(Ki, ee) - float(MIN_POWER);
-          temp_iState[ee] = constrain(temp_iState[ee] + pid_error, 0, max_power_over_i_gain);
-          work_pid[ee].Kp = PID_PARAM(Kp, ee) * pid_error;
-          work_pid[ee].Ki = PID_PARAM(Ki, ee) * temp_iState[ee];
+        #if ENABLED(PID_EXTRUSION_SCALING)
+          float c_term = 0;                     // Extrusion term of the active hotend
+        #endif
 
-          pid_output = work_pid[ee].Kp + work_pid[ee].Ki + work_pid[ee].Kd + float(MIN_POWER);
+        HOTEND_LOOP() {
+          if (!temp_hotend[e].target || error[e] < -(PID_FUNCTIONAL_RANGE) || _TIMED_OUT(e) || error[e] > PID_FUNCTIONAL_RANGE) {
+            // Out of the PID range. Full power to heat up, or none.
+            power[e] = (temp_hotend[e].target && error[e] > PID_FUNCTIONAL_RANGE && !_TIMED_OUT(e)) ? BANG_MAX : 0;
+            pid_iState[e] = pid_dTerm[e] = 0;
+            continue;
+          }
+          pid_dTerm[e] += PID_K2 * (PID_PARAM(Kd, e) * d_input[e] - pid_dTerm[e]);
+          pid_iState[e] = constrain(pid_iState[e] + error[e], 0, pid_iState_max[e]);
+          power[e] = PID_PARAM(Kp, e) * error[e] + PID_PARAM(Ki, e) * pid_iState[e] + pid_dTerm[e] + float(MIN_POWER);
 
           #if ENABLED(PID_EXTRUSION_SCALING)
-            work_pid[ee].Kc = 0;
-            if (_HOTEND_TEST) {
+            #if HOTENDS > 1
+              if (e == active_extruder)
+            #endif
+            {
               const long e_position = stepper.position(E_AXIS);
               if (e_position > last_e_position) {
                 lpq[lpq_ptr] = e_position - last_e_position;
@@ -871,56 +914,57 @@ void Temperature::min_temp_error(const heater_ind_t heater) {
                 lpq[lpq_ptr] = 0;
 
               if (++lpq_ptr >= lpq_len) lpq_ptr = 0;
-              work_pid[ee].Kc = (lpq[lpq_ptr] * planner.steps_to_mm[E_AXIS]) * PID_PARAM(Kc, ee);
-              pid_output += work_pid[ee].Kc;
+              c_term = (lpq[lpq_ptr] * planner.steps_to_mm[E_AXIS]) * PID_PARAM(Kc, e);
+              power[e] += c_term;
             }
-          #endif // PID_EXTRUSION_SCALING
+          #endif
 
-          LIMIT(pid_output, 0, PID_MAX);
+          LIMIT(power[e], 0, PID_MAX);
         }
-        temp_dState[ee] = temp_hotend[ee].celsius;
 
       #else // PID_OPENLOOP
 
-        const float pid_output = constrain(temp_hotend[ee].target, 0, PID_MAX);
+        HOTEND_LOOP() power[e] = constrain(temp_hotend[e].target, 0, PID_MAX);
 
       #endif // PID_OPENLOOP
 
       #if ENABLED(PID_DEBUG)
-        if (e == active_extruder) {
-          SERIAL_ECHO_START();
+        const uint8_t ee = active_extruder;
+        SERIAL_ECHO_START();
+        SERIAL_ECHOPAIR(
+          MSG_PID_DEBUG, ee,
+          MSG_PID_DEBUG_INPUT, celsius[ee],
+          MSG_PID_DEBUG_OUTPUT, power[ee]
+        );
+        #if DISABLED(PID_OPENLOOP)
           SERIAL_ECHOPAIR(
-            MSG_PID_DEBUG, ee,
-            MSG_PID_DEBUG_INPUT, temp_hotend[ee].celsius,
-            MSG_PID_DEBUG_OUTPUT, pid_output
+            MSG_PID_DEBUG_PTERM, PID_PARAM(Kp, ee) * error[ee],
+            MSG_PID_DEBUG_ITERM, PID_PARAM(Ki, ee) * pid_iState[ee],
+            MSG_PID_DEBUG_DTERM, pid_dTerm[ee]
+            #if ENABLED(PID_EXTRUSION_SCALING)
+              , MSG_PID_DEBUG_CTERM, c_term
+            #endif
           );
-          #if DISABLED(PID_OPENLOOP)
-            SERIAL_ECHOPAIR(
-              MSG_PID_DEBUG_PTERM, work_pid[ee].Kp,
-              MSG_PID_DEBUG_ITERM, work_pid[ee].Ki,
-              MSG_PID_DEBUG_DTERM, work_pid[ee].Kd
-              #if ENABLED(PID_EXTRUSION_SCALING)
-                , MSG_PID_DEBUG_CTERM, work_pid[ee].Kc
-              #endif
-            );
-          #endif
-          SERIAL_EOL();
-        }
+        #endif
+        SERIAL_EOL();
       #endif // PID_DEBUG
 
     #else // No PID enabled
 
-      #if HEATER_IDLE_HANDLER
-        #define _TIMED_OUT_TEST hotend_idle[ee].timed_out
-      #else
-        #define _TIMED_OUT_TEST false
-      #endif
-      const float pid_output = (!_TIMED_OUT_TEST && temp_hotend[ee].celsius < temp_hotend[ee].target) ? BANG_MAX : 0;
-      #undef _TIMED_OUT_TEST
+      HOTEND_LOOP() power[e] = (!_TIMED_OUT(e) && celsius[e] < temp_hotend[e].target) ? BANG_MAX : 0;
 
     #endif
 
-    return pid_output;
+    #undef _TIMED_OUT
+
+    HOTEND_LOOP()
+      temp_hotend[e].soft_pwm_amount = (celsius[e] > temp_range[e].mintemp || is_preheating(e)) && celsius[e] < temp_range[e].maxtemp ? (int)power[e] >> 1 : 0;
+
+    #if ENABLED(PID_PROFILE)
+      pid_cycles_last = (micros() - start_us) * ((F_CPU) / 1000000UL);
+      pid_cycles_avg += ((int32_t)pid_cycles_last - (int32_t)pid_cycles_avg) / 16;
+      NOLESS(pid_cycles_max, pid_cycles_last);
+    #endif
   }
 
 #endif // HOTENDS
@@ -1043,9 +1087,12 @@ void Temperature::manage_heater() {
         // Check for thermal runaway
         thermal_runaway_protection(tr_state_machine[e], temp_hotend[e].celsius, temp_hotend[e].target, (heater_ind_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
       #endif
+    }
 
-      temp_hotend[e].soft_pwm_amount = (temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
+    // Set the power of all hotends at once
+    update_hotend_power();
 
+    HOTEND_LOOP() {
       #if WATCH_HOTENDS
         // Make sure temperature is increasing
         if (watch_hotend[e].next_ms && ELAPSED(ms, watch_hotend[e].next_ms)) { // Time to check this extruder?
@@ -2839,8 +2886,7 @@ void Temperature::isr() {
     #if HOTENDS > 1
       if (e >= 0) SERIAL_CHAR('0' + e);
     #endif
-    SERIAL_CHAR(':');
-    SERIAL_ECHO(c);
+    SERIAL_ECHOPAIR(":", c);
     SERIAL_ECHOPAIR(" /" , t);
     #if ENABLED(SHOW_TEMP_ADC_VALUES)
       SERIAL_ECHOPAIR(" (", r * RECIPROCAL(OVERSAMPLENR));
@@ -352,6 +352,18 @@ class Temperature {
       static lpq_ptr_t lpq_ptr;
     #endif
 
+    #if HOTENDS && ENABLED(PIDTEMP) && DISABLED(PID_OPENLOOP)
+      // Hotend PID state, one array per field for the batched update
+      static float pid_iState[HOTENDS],     // Error sum
+                   pid_iState_max[HOTENDS], // Error sum limit, from Ki
+                   pid_dState[HOTENDS],     // Previous temperature
+                   pid_dTerm[HOTENDS];      // Filtered D term
+    #endif
+
+    #if ENABLED(PID_PROFILE)
+      static uint32_t pid_cycles_last, pid_cycles_avg, pid_cycles_max;
+    #endif
+
     #if HOTENDS
       static temp_range_t temp_range[HOTENDS];
     #endif
@@ -749,11 +761,11 @@ class Temperature {
        * Update the temp manager when PID values change
        */
       #if ENABLED(PIDTEMP)
-        FORCE_INLINE static void updatePID() {
-          #if ENABLED(PID_EXTRUSION_SCALING)
-            last_e_position = 0;
-          #endif
-        }
+        static void updatePID();
+      #endif
+
+      #if ENABLED(PID_PROFILE)
+        static void report_pid_profile();
       #endif
 
     #endif
@@ -827,7 +839,9 @@ class Temperature {
 
     static void checkExtruderAutoFans();
 
-    static float get_pid_output_hotend(const uint8_t e);
+    #if HOTENDS
+      static void update_hotend_power();
+    #endif
 
     #if ENABLED(PIDTEMPBED)
       static float get_pid_output_bed();
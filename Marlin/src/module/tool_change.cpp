@@ -57,6 +57,10 @@
   #include "../feature/solenoid.h"
 #endif
 
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #include "../feature/tool_preheat.h"
+#endif
+
 #if ENABLED(MK2_MULTIPLEXER)
   #include "../feature/snmm.h"
 #endif
@@ -182,7 +186,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     }
 
     planner.buffer_line(current_position, mpe_settings.fast_feedrate, new_tool);
-    planner.synchronize();
 
     // STEP 2
 
@@ -194,7 +197,7 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     }
 
     planner.buffer_line(current_position, mpe_settings.slow_feedrate, new_tool);
-    planner.synchronize();
+    planner.synchronize();  // The carriage must be in place before the coupling delay
 
     // Delay before moving tool, to allow magnetic coupling
     gcode.dwell(150);
@@ -208,7 +211,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     }
 
     planner.buffer_line(current_position, mpe_settings.slow_feedrate, new_tool);
-    planner.synchronize();
 
     // STEP 4
 
@@ -219,7 +221,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     }
 
     planner.buffer_line(current_position, mpe_settings.fast_feedrate, new_tool);
-    planner.synchronize();
 
     // STEP 5
 
@@ -231,7 +232,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     }
 
     planner.buffer_line(current_position, mpe_settings.slow_feedrate, new_tool);
-    planner.synchronize();
 
     // STEP 6
 
@@ -243,7 +243,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     }
 
     planner.buffer_line(current_position, mpe_settings.fast_feedrate, new_tool);
-    planner.synchronize();
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Autopark done.");
   }
@@ -351,12 +350,12 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
         DEBUG_POS("(6) Move midway between hotends", current_position);
       }
       fast_line_to_current(X_AXIS);
-      planner.synchronize(); // Always sync the final move
 
       if (DEBUGGING(LEVELING)) DEBUG_POS("PE Tool-Change done.", current_position);
     }
     else { // nomove == true
-      // Only engage magnetic field for new extruder
+      // Only engage magnetic field for new extruder, once the moves are done
+      planner.synchronize();
       pe_activate_solenoid(new_tool);
       #if ENABLED(PARKING_EXTRUDER_SOLENOIDS_INVERT)
         pe_activate_solenoid(active_extruder); // Just save power for inverted magnets
@@ -457,7 +456,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     current_position[Y_AXIS] -= SWITCHING_TOOLHEAD_Y_CLEAR;
     if (DEBUGGING(LEVELING)) DEBUG_POS("Move back Y clear", current_position);
     fast_line_to_current(Y_AXIS); // Move away from docked toolhead
-    planner.synchronize();        // Always sync the final move
 
     if (DEBUGGING(LEVELING)) DEBUG_POS("ST Tool-Change done.", current_position);
   }
@@ -584,7 +582,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     current_position[Y_AXIS] += SWITCHING_TOOLHEAD_Y_CLEAR;
     if (DEBUGGING(LEVELING)) DEBUG_POS("Move back Y clear", current_position);
     fast_line_to_current(Y_AXIS); // move away from docked toolhead
-    planner.synchronize(); // Always sync last tool-change move
 
     if (DEBUGGING(LEVELING)) DEBUG_POS("MST Tool-Change done.", current_position);
   }
@@ -684,7 +681,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
     current_position[Y_AXIS] += SWITCHING_TOOLHEAD_Y_CLEAR;
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("(8) Unpark extruder");
     slow_line_to_current(X_AXIS);
-    planner.synchronize(); // Always sync the final move
 
     // 9. Apply Z hotend offset to current position
 
@@ -727,7 +723,6 @@ inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_a
 
       // Park old head
       planner.buffer_line(xhome, current_position[Y_AXIS], current_position[Z_AXIS], current_position[E_AXIS], planner.settings.max_feedrate_mm_s[X_AXIS], active_extruder);
-      planner.synchronize();
     }
 
     // Activate the new extruder ahead of calling set_axis_is_at_home!
@@ -805,7 +800,12 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
   #else // EXTRUDERS > 1
 
-    planner.synchronize();
+    /**
+     * Moves, offsets and position changes are queued in order with the
+     * surrounding moves. Blocks carry their own extruder, and position
+     * changes go through planner sync blocks, so only servo, solenoid and
+     * other direct I/O actions need to wait for the planner to empty.
+     */
 
     #if ENABLED(DUAL_X_CARRIAGE)  // Only T0 allowed if the Printer is in DXC_DUPLICATION_MODE or DXC_MIRRORED_MODE
       if (new_tool != 0 && dxc_is_duplicating())
@@ -815,6 +815,10 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
     if (new_tool >= EXTRUDERS)
       return invalid_extruder_error(new_tool);
 
+    #if ENABLED(TOOLCHANGE_PREHEAT)
+      tool_preheat.tool_change(new_tool); // Bring a tool out of standby if it wasn't preheated
+    #endif
+
     if (!no_move && !all_axes_homed()) {
       no_move = true;
       if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("No move (not homed)");
@@ -854,15 +858,14 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
           #else
             current_position[E_AXIS] -= toolchange_settings.swap_length / planner.e_factor[old_tool];
             planner.buffer_line(current_position, MMM_TO_MMS(toolchange_settings.retract_speed), old_tool);
-            planner.synchronize();
           #endif
         }
       }
     #endif // TOOLCHANGE_FILAMENT_SWAP
 
     #if HAS_LEVELING
-      // Set current position to the physical position
-      TEMPORARY_BED_LEVELING_STATE(false);
+      // Set current position to the physical position, in order with the moves
+      QUEUED_BED_LEVELING_STATE(false);
     #endif
 
     if (new_tool != old_tool) {
@@ -901,7 +904,6 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             current_position[Y_AXIS] = toolchange_settings.change_point.y;
           #endif
           planner.buffer_line(current_position, feedrate_mm_s, old_tool);
-          planner.synchronize();
         }
       #endif
 
@@ -990,7 +992,6 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
               current_position[E_AXIS] += toolchange_settings.extra_prime / planner.e_factor[new_tool];
               planner.buffer_line(current_position, MMM_TO_MMS(toolchange_settings.prime_speed * 0.2f), new_tool);
             #endif
-            planner.synchronize();
             planner.set_e_position_mm((destination[E_AXIS] = current_position[E_AXIS] = current_position[E_AXIS] - (TOOLCHANGE_FIL_EXTRA_PRIME)));
           }
         #endif
@@ -1001,7 +1002,6 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
           if (destination[Y_AXIS] < SWITCHING_TOOLHEAD_Y_POS + SWITCHING_TOOLHEAD_Y_CLEAR) {
             current_position[X_AXIS] = 0;
             planner.buffer_line(current_position, planner.settings.max_feedrate_mm_s[X_AXIS], new_tool);
-            planner.synchronize();
           }
         #else
           apply_motion_limits(destination);
@@ -1012,11 +1012,11 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
           #if ENABLED(TOOLCHANGE_NO_RETURN)
             // Just move back down
             if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Move back Z only");
-            do_blocking_move_to_z(destination[Z_AXIS], planner.settings.max_feedrate_mm_s[Z_AXIS]);
+            do_move_to(current_position[X_AXIS], current_position[Y_AXIS], destination[Z_AXIS], planner.settings.max_feedrate_mm_s[Z_AXIS]);
           #else
             // Move back to the original (or adjusted) position
             if (DEBUGGING(LEVELING)) DEBUG_POS("Move back", destination);
-            do_blocking_move_to(destination);
+            do_move_to(destination);
           #endif
         }
         else if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Move back skipped");
@@ -1028,7 +1028,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
       #if ENABLED(SWITCHING_NOZZLE)
         else {
           // Move back down. (Including when the new tool is higher.)
-          do_blocking_move_to_z(destination[Z_AXIS], planner.settings.max_feedrate_mm_s[Z_AXIS]);
+          do_move_to(current_position[X_AXIS], current_position[Y_AXIS], destination[Z_AXIS], planner.settings.max_feedrate_mm_s[Z_AXIS]);
         }
       #endif
 
@@ -1042,7 +1042,10 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
     } // (new_tool != old_tool)
 
-    planner.synchronize();
+    // Direct I/O below takes effect at once, so wait for the moves to finish
+    #if (ENABLED(EXT_SOLENOID) && DISABLED(PARKING_EXTRUDER)) || ENABLED(MK2_MULTIPLEXER) || HAS_FANMUX
+      planner.synchronize();
+    #endif
 
     #if ENABLED(EXT_SOLENOID) && DISABLED(PARKING_EXTRUDER)
       disable_all_solenoids();
@@ -1055,7 +1058,6 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
     #endif
 
     #if DO_SWITCH_EXTRUDER
-      planner.synchronize();
       move_extruder_servo(active_extruder);
     #endif
 
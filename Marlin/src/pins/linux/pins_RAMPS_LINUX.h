@@ -206,6 +206,7 @@
 //
 #define SDSS               53
 #define LED_PIN            13
+#define SDIO_SUPPORT              // The SD card is a disk image file. See HAL_LINUX/sdio.cpp
 
 #ifndef FILWIDTH_PIN
   #define FILWIDTH_PIN      5   // Analog Input on AUX2
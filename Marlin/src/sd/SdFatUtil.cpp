@@ -46,6 +46,10 @@
     return &top - reinterpret_cast<char*>(sbrk(0));
   }
 
+#elif defined(__PLAT_LINUX__)
+
+  int SdFatUtil::FreeRam() { return freeMemory(); }
+
 #else
 
   extern char* __brkval;
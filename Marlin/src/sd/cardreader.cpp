@@ -664,7 +664,7 @@ const char* CardReader::diveToFile(SdFile*& curDir, const char * const path, con
   // Start dive
   while (dirname_start) {
     // Find next sub
-    char * const dirname_end = strchr(dirname_start, '/');
+    const char * const dirname_end = strchr(dirname_start, '/');
     if (dirname_end <= dirname_start) break;
 
     // Set subDirName
@@ -111,6 +111,18 @@ static enum {
   uint32_t lun0_capacity;
 #endif
 
+#if defined(USB_READ_AHEAD_BLOCKS) && USB_READ_AHEAD_BLOCKS > 1
+  #define HAS_USB_READ_AHEAD 1
+#endif
+
+#if HAS_USB_READ_AHEAD
+  // Sectors read ahead while a file is read in order
+  static uint8_t ahead_buffer[USB_READ_AHEAD_BLOCKS][512];
+  static uint32_t ahead_start,              // First sector in the buffer
+                  last_block = 0xFFFFFFFF;  // Last sector read
+  static uint8_t ahead_count;               // Sectors in the buffer
+#endif
+
 bool Sd2Card::usbStartup() {
   if (state <= DO_STARTUP) {
     SERIAL_ECHOPGM("Starting USB host...");
@@ -282,6 +294,11 @@ bool Sd2Card::init(const uint8_t, const pin_t) {
     lun0_capacity = bulk.GetCapacity(0);
     SERIAL_ECHOLNPAIR("LUN Capacity (in blocks): ", lun0_capacity);
   #endif
+
+  #if HAS_USB_READ_AHEAD
+    ahead_count = 0;
+    last_block = 0xFFFFFFFF;
+  #endif
   return true;
 }
 
@@ -306,6 +323,33 @@ bool Sd2Card::readBlock(uint32_t block, uint8_t* dst) {
       SERIAL_ECHOLNPAIR("Read block ", block);
     #endif
   #endif
+
+  #if HAS_USB_READ_AHEAD
+    // A read that follows the last one, or the sectors in the buffer, is part of a file read in order
+    const bool in_order = block == last_block + 1 || (ahead_count && block == ahead_start + ahead_count);
+    last_block = block;
+
+    const uint32_t offset = block - ahead_start;
+    if (offset < ahead_count) {
+      memcpy(dst, ahead_buffer[offset], 512);
+      return true;
+    }
+
+    if (in_order) {
+      // Read this sector and the ones after it in a single command
+      const uint32_t capacity = bulk.GetCapacity(0);
+      const uint8_t count = block < capacity ? _MIN(capacity - block, uint32_t(USB_READ_AHEAD_BLOCKS)) : 0;
+      if (count > 1) {
+        ahead_count = 0;
+        if (bulk.Read(0, block, 512, count, ahead_buffer[0]) != 0) return false;
+        ahead_start = block;
+        ahead_count = count;
+        memcpy(dst, ahead_buffer[0], 512);
+        return true;
+      }
+    }
+  #endif
+
   return bulk.Read(0, block, 512, 1, dst) == 0;
 }
 
@@ -320,6 +364,13 @@ bool Sd2Card::writeBlock(uint32_t block, const uint8_t* src) {
       SERIAL_ECHOLNPAIR("Write block ", block);
     #endif
   #endif
+
+  #if HAS_USB_READ_AHEAD
+    // Keep the read-ahead buffer up to date
+    const uint32_t offset = block - ahead_start;
+    if (offset < ahead_count) memcpy(ahead_buffer[offset], src, 512);
+  #endif
+
   return bulk.Write(0, block, 512, 1, src) == 0;
 }
 
@@ -0,0 +1,150 @@
+/**
+ * Host test for the L6470 chain status read
+ *
+ * Runs the SPI code from HAL_spi_L6470.cpp against a bit-level model of a
+ * daisy chain. Checks the status each chip reports, and that a direction
+ * change from the stepper ISR in the middle of the read drops the sample,
+ * reaches every chip intact, and never finds a byte half sent.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "src/libs/L6470/L6470_Marlin.h"
+
+static int failures = 0;
+
+#define CHECK(COND, ...) do{ if (!(COND)) { failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); putchar('\n'); } }while(0)
+
+uint8_t L6470::chain[21];
+L6470_Marlin L6470;
+volatile bool L6470_Marlin::spi_abort = false;
+bool L6470_Marlin::spi_active = false;
+
+// A chip shifts MOSI in on the rising clock edge and its MSB out on the falling
+// edge. Bytes are framed by SS. The first chip takes MOSI, the last drives MISO.
+struct Chip {
+  uint8_t reg, out[2], nout, last_cmd;
+  uint16_t status;
+};
+
+#define CHIPS 3
+static Chip chip[CHIPS + 1];  // By chain position, 1 is nearest MOSI
+static bool sck = true, ss = true, mosi, miso;
+static uint16_t bits;         // Clocked since SS went low
+
+static bool isrs_off, in_isr;
+static int isr_after = -1;    // Bytes the main code sends before the ISR cuts in
+static uint8_t isr_cmd;
+static int misplaced;         // Bits clocked with interrupts on outside the ISR
+
+static void chip_latch() {
+  if (bits != CHIPS * 8) return; // An incomplete frame is ignored
+  for (uint8_t j = 1; j <= CHIPS; j++) {
+    Chip &c = chip[j];
+    if (c.nout) { c.out[0] = c.out[1]; c.nout--; }
+    else if (c.reg == dSPIN_GET_STATUS) { c.out[0] = c.status >> 8; c.out[1] = c.status & 0xFF; c.nout = 2; }
+    else if (c.reg != dSPIN_NOP) c.last_cmd = c.reg;
+  }
+}
+
+void mock_write(const int16_t pin, const bool level) {
+  switch (pin) {
+    case L6470_CHAIN_SS_PIN:
+      if (level && !ss) chip_latch();
+      if (!level && ss) {
+        bits = 0;
+        for (uint8_t j = 1; j <= CHIPS; j++) chip[j].reg = chip[j].nout ? chip[j].out[0] : 0;
+      }
+      ss = level;
+      break;
+    case L6470_CHAIN_MOSI_PIN: mosi = level; break;
+    case L6470_CHAIN_SCK_PIN:
+      if (!ss && !level && sck) miso = chip[CHIPS].reg >> 7;
+      if (!ss && level && !sck) {
+        if (!in_isr && !isrs_off) misplaced++;
+        for (uint8_t j = CHIPS; j >= 1; j--)
+          chip[j].reg = (chip[j].reg << 1) | (j > 1 ? chip[j - 1].reg >> 7 : mosi);
+        bits++;
+      }
+      sck = level;
+      break;
+  }
+}
+
+bool mock_read(const int16_t pin) { return pin == L6470_CHAIN_MISO_PIN ? miso : false; }
+
+void mock_disable_isrs() {
+  CHECK(!in_isr, "interrupts disabled from the ISR");
+  isrs_off = true;
+}
+
+// Stand in for the stepper ISR sending new directions, as L6470_Marlin::send_dir_commands does
+void mock_enable_isrs() {
+  CHECK(!in_isr, "interrupts enabled from the ISR");
+  isrs_off = false;
+  if (isr_after < 0 || isr_after--) return;
+  in_isr = true;
+  uint8_t buf[MAX_L6470 + 1];
+  if (L6470.spi_active) {
+    L6470.spi_abort = true;
+    for (uint8_t n = 3; n--;) {
+      for (uint8_t j = 1; j <= CHIPS; j++) buf[j] = dSPIN_NOP;
+      L6470_transfer(buf, CHIPS);
+    }
+  }
+  for (uint8_t j = 1; j <= CHIPS; j++) buf[j] = isr_cmd;
+  L6470_transfer(buf, CHIPS);
+  in_isr = false;
+}
+
+static void reset_chain() {
+  for (uint8_t j = 1; j <= CHIPS; j++) { chip[j] = Chip(); chip[j].status = 0x7E00 | (j << 4) | j; }
+  L6470::chain[0] = CHIPS;
+  isr_after = -1;
+  misplaced = 0;
+}
+
+// Read the status the way L6470_Marlin::monitor_driver does
+static bool read_status(uint16_t status[]) {
+  L6470.spi_active = true;
+  const bool ok = L6470_get_chain_status(status, CHIPS);
+  L6470.spi_active = L6470.spi_abort = false;
+  return ok;
+}
+
+static void test_status() {
+  reset_chain();
+  uint16_t status[MAX_L6470 + 1];
+  CHECK(read_status(status), "read aborted with no ISR");
+  for (uint8_t j = 1; j <= CHIPS; j++)
+    CHECK(status[j] == chip[j].status, "chip %u status %04X, expected %04X", j, status[j], chip[j].status);
+  CHECK(!misplaced, "%d bits clocked with interrupts on", misplaced);
+}
+
+static void test_isr_cut_in() {
+  // Cut in after each byte of the three frames in turn
+  for (int after = 0; after < 3 * CHIPS; after++) {
+    reset_chain();
+    isr_after = after;
+    isr_cmd = dSPIN_STEP_CLOCK + (after & 1);
+    uint16_t status[MAX_L6470 + 1];
+    CHECK(!read_status(status), "sample kept with the ISR after byte %d", after);
+    for (uint8_t j = 1; j <= CHIPS; j++) {
+      CHECK(chip[j].last_cmd == isr_cmd, "chip %u got %02X after byte %d", j, chip[j].last_cmd, after);
+      CHECK(!chip[j].nout, "chip %u left a reply pending after byte %d", j, after);
+    }
+    CHECK(!misplaced, "%d bits clocked with interrupts on", misplaced);
+
+    // The next sample reads fine
+    isr_after = -1;
+    CHECK(read_status(status) && status[CHIPS] == chip[CHIPS].status, "read after the ISR cut in after byte %d", after);
+  }
+}
+
+int main() {
+  test_status();
+  test_isr_cut_in();
+  printf("l6470_chain_status: %s\n", failures ? "FAILED" : "OK");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,24 @@
+; Reference moves for motion_compare.py
+; Long moves first, so the first blocks are fully planned before they start
+M302 P1             ; Allow cold extrusion
+M201 X1000 Y1000 Z100 E5000
+M204 P1000 R2000 T1000
+G90
+M83
+G1 X40 Y0 F3000
+G1 X40 Y40 F6000
+G1 X0 Y40 E2 F1800
+G1 X0 Y0 F9000
+G1 Z1 F300
+; Short segments of an arc, with junction speeds below nominal
+G1 X5 Y1 E0.2 F4800
+G1 X10 Y3 E0.2
+G1 X15 Y6 E0.2
+G1 X20 Y10 E0.2
+G1 X24 Y15 E0.2
+G1 X27 Y21 E0.2
+G1 X29 Y28 E0.2
+; Retract and unretract
+G1 E-2 F2400
+G1 E2
+G1 X0 Y0 Z0 F6000
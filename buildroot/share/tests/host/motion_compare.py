@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Run G-code through the Linux simulator and compare the planned motion with a reference
+
+The simulator must be a linux_native build with -DMOTION_LOGGING. It runs in a
+scratch directory, its block_log.csv is compared row by row with the reference,
+and the step pulses in step_log.csv are checked against the block step counts.
+
+Step counts and directions must match exactly. Rates and trapezoid points may
+differ by --rtol (relative) or --atol (absolute), whichever is larger, to allow
+for floating point differences between compilers and platforms.
+
+Usage: motion_compare.py [--rtol R] [--atol A] [--update] marlin gcode reference.csv
+"""
+
+import argparse
+import collections
+import csv
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+EXACT = ('steps_x', 'steps_y', 'steps_z', 'steps_e', 'direction_bits', 'step_event_count')
+STEP_AXES = ('steps_x', 'steps_y', 'steps_z', 'steps_e')
+
+parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+parser.add_argument('--rtol', type=float, default=0.02, help='relative tolerance for rates (default=0.02)')
+parser.add_argument('--atol', type=float, default=2, help='absolute tolerance for rates and step indexes (default=2)')
+parser.add_argument('--timeout', type=float, default=60, help='seconds to wait for the run (default=60)')
+parser.add_argument('--update', action='store_true', help='write the new block log to the reference instead of comparing')
+parser.add_argument('marlin')
+parser.add_argument('gcode')
+parser.add_argument('reference')
+args = parser.parse_args()
+
+def run(workdir):
+  """Send the G-code line by line as a host would, then wait for the moves to finish"""
+  lines = [l.split(';')[0].strip() for l in open(args.gcode)]
+  lines = [l for l in lines if l] + ['M400']
+  proc = subprocess.Popen([os.path.abspath(args.marlin)], cwd=workdir, stdin=subprocess.PIPE,
+                          stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, universal_newlines=True, bufsize=1)
+  acks = threading.Semaphore(0)
+  def reader():
+    for line in proc.stdout:
+      if line.startswith('ok'): acks.release()
+  threading.Thread(target=reader, daemon=True).start()
+  try:
+    for l in lines:
+      proc.stdin.write(l + '\n')
+      if not acks.acquire(timeout=args.timeout):
+        sys.exit('No reply to %s' % l)
+    time.sleep(0.5) # Let the simulation loop write out the logs
+  finally:
+    proc.kill()
+    proc.wait()
+
+def read_csv(path):
+  with open(path) as f:
+    return [{k.strip(): int(v) for k, v in row.items()} for row in csv.DictReader(f, skipinitialspace=True)]
+
+def check_steps(blocks, step_log):
+  """Each step pin must pulse as often as one axis was asked to step"""
+  pulses = collections.Counter(int(row[1]) for row in csv.reader(open(step_log)) if row)
+  wanted = sorted(n for n in (sum(b[a] for b in blocks) for a in STEP_AXES) if n)
+  got = sorted(pulses.values())
+  if wanted != got:
+    return ['step pulses per pin %s, expected %s' % (got, wanted)]
+  return []
+
+def compare(blocks, reference):
+  errors = []
+  if len(blocks) != len(reference):
+    errors.append('%d blocks, expected %d' % (len(blocks), len(reference)))
+  for n, (got, ref) in enumerate(zip(blocks, reference), 1):
+    for key, want in ref.items():
+      have = got.get(key)
+      if have is None:
+        errors.append('block %d: no %s' % (n, key))
+      elif key in EXACT:
+        if have != want: errors.append('block %d: %s %d, expected %d' % (n, key, have, want))
+      elif abs(have - want) > max(args.atol, args.rtol * abs(want)):
+        errors.append('block %d: %s %d, expected %d' % (n, key, have, want))
+  return errors
+
+workdir = tempfile.mkdtemp(prefix='motion_')
+try:
+  run(workdir)
+  blocks = read_csv(os.path.join(workdir, 'block_log.csv'))
+  errors = check_steps(blocks, os.path.join(workdir, 'step_log.csv'))
+  if args.update:
+    shutil.copy(os.path.join(workdir, 'block_log.csv'), args.reference)
+    print('%s: %d blocks written' % (args.reference, len(blocks)))
+  else:
+    errors += compare(blocks, read_csv(args.reference))
+finally:
+  shutil.rmtree(workdir)
+
+for e in errors: print(e)
+print('%s: %s' % (os.path.basename(args.gcode), 'FAILED' if errors else 'OK'))
+sys.exit(1 if errors else 0)
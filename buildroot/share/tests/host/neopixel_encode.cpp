@@ -0,0 +1,73 @@
+/**
+ * Host test for the NeoPixel SPI bitstream encoder
+ *
+ * Decodes the bitstream the way a WS2812 would and checks it against the
+ * input, along with the SPI bit timing and the latch time at the end.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../../../../Marlin/src/feature/leds/neopixel_encode.h"
+
+static int failures = 0;
+
+#define CHECK(COND, ...) do{ if (!(COND)) { failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); putchar('\n'); } }while(0)
+
+static uint8_t spi_bit(const uint8_t *buf, const uint32_t n) { return (buf[n >> 3] >> (7 - (n & 7))) & 1; }
+
+// Decode each 3-bit symbol, requiring the 1X0 shape for valid high and low times
+static bool decode(const uint8_t *buf, const uint16_t len, uint8_t *out) {
+  for (uint16_t i = 0; i < len; i++) {
+    uint8_t b = 0;
+    for (uint8_t n = 0; n < 8; n++) {
+      const uint32_t s = (i * 8UL + n) * 3;
+      if (spi_bit(buf, s) != 1 || spi_bit(buf, s + 2) != 0) return false;
+      b = (b << 1) | spi_bit(buf, s + 1);
+    }
+    out[i] = b;
+  }
+  return true;
+}
+
+static void test_known_bytes() {
+  const uint8_t src[] = { 0x00, 0xFF, 0xA5 };
+  uint8_t dst[NEO_SPI_FRAME_SIZE(sizeof(src))];
+  neo_spi_encode(src, sizeof(src), dst);
+  const uint8_t expect[] = { 0x92, 0x49, 0x24,   // 100 100 100 100 100 100 100 100
+                             0xDB, 0x6D, 0xB6,   // 110 110 110 110 110 110 110 110
+                             0xD3, 0x49, 0xA6 }; // 110 100 110 100 100 110 100 110
+  CHECK(!memcmp(dst, expect, sizeof(expect)), "known byte patterns");
+}
+
+static void test_frame() {
+  // A run of 3-pixel GRBW frames with varied byte values
+  uint8_t src[12], dst[NEO_SPI_FRAME_SIZE(sizeof(src))], back[sizeof(src)];
+  for (uint16_t v = 0; v < 256; v += sizeof(src)) {
+    for (uint8_t i = 0; i < sizeof(src); i++) src[i] = uint8_t(v + i * 37);
+    memset(dst, 0x55, sizeof(dst));
+    const uint16_t len = neo_spi_encode(src, sizeof(src), dst);
+    CHECK(len == sizeof(dst), "length %u, expected %u", len, unsigned(sizeof(dst)));
+    CHECK(decode(dst, sizeof(src), back) && !memcmp(src, back, sizeof(src)), "round trip at %u", v);
+    bool low = true;
+    for (uint16_t i = sizeof(src) * 3; i < len; i++) low &= dst[i] == 0;
+    CHECK(low, "latch bytes not zero");
+  }
+}
+
+static void test_timing() {
+  const float bit_ns = 1e9f / NEO_SPI_CLOCK;
+  // WS2812B datasheet: T0H 400±150ns, T1H 800±150ns, bit period 1250±600ns
+  CHECK(bit_ns >= 250 && bit_ns <= 550, "T0H %.0fns", bit_ns);
+  CHECK(bit_ns * 2 >= 650 && bit_ns * 2 <= 950, "T1H %.0fns", bit_ns * 2);
+  CHECK(bit_ns * 3 >= 650 && bit_ns * 3 <= 1850, "period %.0fns", bit_ns * 3);
+  CHECK(NEO_SPI_RESET_BYTES * 8 * bit_ns >= 280000, "latch %.0fns", NEO_SPI_RESET_BYTES * 8 * bit_ns);
+}
+
+int main() {
+  test_known_bytes();
+  test_frame();
+  test_timing();
+  printf("neopixel_encode: %s\n", failures ? "FAILED" : "OK");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,15 @@
+/**
+ * Stub of the Arduino-L6470 library with just what the SPI code uses
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define dSPIN_NOP         0x00
+#define dSPIN_STEP_CLOCK  0x58
+#define dSPIN_GET_STATUS  0xD0
+
+class L6470 {
+public:
+  static uint8_t chain[21];  // chain[0] is the chain length, chain[j] the chip index at position j
+};
@@ -0,0 +1,4 @@
+#pragma once
+
+#define DELAY_NS(x) do{}while(0)
+#define DELAY_US(x) do{}while(0)
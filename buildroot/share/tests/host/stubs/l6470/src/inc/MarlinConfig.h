@@ -0,0 +1,32 @@
+/**
+ * Stub configuration for building the L6470 SPI code on the host.
+ * The pin and interrupt calls go to the mock chain in l6470_chain_status.cpp.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define HAS_DRIVER(T) 1
+#define PIN_EXISTS(PN) 0
+
+#define LOW  0
+#define HIGH 1
+
+#define L6470_CHAIN_SCK_PIN  1
+#define L6470_CHAIN_MISO_PIN 2
+#define L6470_CHAIN_MOSI_PIN 3
+#define L6470_CHAIN_SS_PIN   4
+
+void mock_write(const int16_t pin, const bool level);
+bool mock_read(const int16_t pin);
+void mock_disable_isrs();
+void mock_enable_isrs();
+
+#define WRITE(IO,V)          mock_write(IO, V)
+#define READ(IO)             mock_read(IO)
+#define OUT_WRITE(IO,V)      mock_write(IO, V)
+#define SET_INPUT(IO)        do{}while(0)
+#define extDigitalWrite(IO,V) mock_write(IO, V)
+
+#define DISABLE_ISRS() mock_disable_isrs()
+#define ENABLE_ISRS()  mock_enable_isrs()
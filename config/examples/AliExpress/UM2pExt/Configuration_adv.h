@@ -197,6 +197,9 @@
     #define DEFAULT_Kc (100) //heating power=Kc*(e_speed)
     #define LPQ_MAX_LEN 50
   #endif
+
+  // Time the hotend update in manage_heater(). M301 reports its cost in CPU cycles.
+  //#define PID_PROFILE
 #endif
 
 /**
@@ -1039,6 +1042,13 @@
      *   [1] This requires USB_INTR_PIN to be interrupt-capable.
      */
     //#define USE_UHS3_USB
+
+    /**
+     * Read several sectors with each USB command while a file is read in
+     * order. This cuts the command overhead when printing from a USB drive.
+     * Uses 512 bytes of RAM per sector. Disable to read each sector on its own.
+     */
+    //#define USB_READ_AHEAD_BLOCKS 4
   #endif
 
   /**
@@ -1115,6 +1125,10 @@
   // The normal delay is 10µs. Use the lowest value that still gives a reliable display.
   //#define DOGM_SPI_DELAY_US 5
 
+  // Keep a shadow copy of the display RAM and send only the parts of each
+  // page that changed since the last frame. Costs 1K of RAM. (32-bit only)
+  //#define DOGM_DIRTY_REGIONS
+
   // Swap the CW/CCW indicators in the graphics overlay
   //#define OVERLAY_GFX_REVERSE
 
@@ -1458,6 +1472,18 @@
   #define BLOCK_BUFFER_SIZE 16 // maximize block buffer
 #endif
 
+// Hold off cosmetic idle() tasks (LCD redraw, debug LEDs, auto-reports,
+// print job timer) while the planner is running low on moves, so the main
+// loop gets back to parsing and planning sooner during short, fast segments.
+// Buttons, encoder, SD detect and menu timeout are still polled.
+// This is a fixed hold-off in idle(), not a task scheduler. There is no task
+// registry, no priorities to set and no per-task run time statistics.
+//#define IDLE_DEFER_LOW_PRIORITY
+#if ENABLED(IDLE_DEFER_LOW_PRIORITY)
+  #define IDLE_DEFER_MIN_BLOCKS   4 // Defer while fewer moves than this are planned
+  #define IDLE_DEFER_MAX_MS     250 // (ms) Never hold off low priority tasks for longer
+#endif
+
 // @section serial
 
 // The ASCII buffer for serial input
@@ -1590,6 +1616,23 @@
     #define TOOLCHANGE_PARK_XY    { X_MIN_POS + 10, Y_MIN_POS + 10 }
     #define TOOLCHANGE_PARK_XY_FEEDRATE 6000  // (mm/m)
   #endif
+
+  /**
+   * Lookahead tool preheat
+   * Scan the command queue and the SD file ahead of the print for each
+   * tool's next use, estimate when it comes from the planned moves, and
+   * start heating the tool just in time. Tools not needed for a while are
+   * dropped to a standby temperature.
+   * The print temperature comes from M109, or M104 for the active tool.
+   */
+  //#define TOOLCHANGE_PREHEAT
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    #define TOOLCHANGE_PREHEAT_SCAN_BYTES  8192  // (bytes) How far to read ahead in the SD file
+    #define TOOLCHANGE_PREHEAT_RATE           2  // (°C/s) A conservative hotend heating rate, for timing
+    #define TOOLCHANGE_PREHEAT_MARGIN        15  // (s) Extra time allowed for heating
+    #define TOOLCHANGE_PREHEAT_STANDBY_TIME 120  // (s) Drop a tool to standby if not needed for this long
+    #define TOOLCHANGE_PREHEAT_STANDBY_TEMP 150  // (°C) Standby temperature for idle tools
+  #endif
 #endif
 
 /**
@@ -2307,6 +2350,17 @@
     #define SPEED_POWER_INTERCEPT  0
     #define SPEED_POWER_MIN       10
     #define SPEED_POWER_MAX      100    // 0-100%
+
+    /**
+     * Inline laser power. M3/M4/M5 don't wait for the planner to empty.
+     * The power is stored with each following move and applied by the
+     * stepper as the move starts, so raster jobs run at full speed.
+     * There is no power-up / power-down delay in this mode.
+     */
+    //#define LASER_POWER_INLINE
+    #if ENABLED(LASER_POWER_INLINE)
+      //#define LASER_POWER_INLINE_TRAPEZOID  // Scale power with speed during acceleration / deceleration
+    #endif
   #endif
 #endif
 
@@ -2325,6 +2379,19 @@
   #define COOLANT_FLOOD_INVERT false  // Set "true" if the on/off function is reversed
 #endif
 
+/**
+ * Inline Output Events
+ *
+ * Let M42, M280, M7/M8/M9, M240 (CHDK) and planner fan changes wait in the
+ * planner and apply them as the next queued move starts. Outputs change in
+ * step with motion, without the planner stall of M400. A quick stop (M410,
+ * print abort) applies the waiting changes at once.
+ */
+//#define INLINE_OUTPUT_EVENTS
+#if ENABLED(INLINE_OUTPUT_EVENTS)
+  #define INLINE_OUTPUT_EVENTS_PER_BLOCK 4  // Output changes that can start with a single move
+#endif
+
 /**
  * Filament Width Sensor
  *
@@ -2371,6 +2438,17 @@
  */
 #define AUTO_REPORT_TEMPERATURES
 
+/**
+ * Binary telemetry with M155 B<milliseconds>
+ * Send temperatures, position, queue depth and SD progress as compact
+ * binary packets. Only changed fields are sent between complete frames.
+ * Requires BINARY_FILE_TRANSFER.
+ */
+//#define BINARY_TELEMETRY
+#if ENABLED(BINARY_TELEMETRY)
+  #define BINARY_TELEMETRY_KEYFRAME 5 // (s) Time between complete frames
+#endif
+
 /**
  * Include capabilities in M115 output
  */
@@ -2574,7 +2652,7 @@
    * this setting determines the minimum update time between checks. A value of 100 works well with
    * error rolling average when attempting to correct only for skips and not for vibration.
    */
-  #define I2CPE_MIN_UPD_TIME_MS     4                       // (ms) Minimum time between encoder checks.
+  #define I2CPE_MIN_UPD_TIME_MS     1                       // (ms) Minimum time between checks of each encoder.
 
   // Use a rolling average to identify persistant errors that indicate skips, as opposed to vibration and noise.
   #define I2CPE_ERR_ROLLING_AVERAGE
@@ -2675,6 +2753,10 @@
   // G-code to execute when MMU2 F.I.N.D.A. probe detects filament runout
   #define MMU2_FILAMENT_RUNOUT_SCRIPT "M600"
 
+  // Let T commands return at once and hold the moves after them in the planner.
+  // The MMU starts the change when the moves with the current filament finish.
+  //#define MMU2_PIPELINED_TOOLCHANGE
+
   // Add an LCD menu for MMU2
   //#define MMU2_MENUS
   #if ENABLED(MMU2_MENUS)